@@ -0,0 +1,151 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_AVS_INCLUDE_AVSCOMMON_AVS_ATTACHMENT_ATTACHMENTBUFFERPOOL_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_AVS_INCLUDE_AVSCOMMON_AVS_ATTACHMENT_ATTACHMENTBUFFERPOOL_H_
+
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "AVSCommon/Utils/SDS/InProcessSDS.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace avs {
+namespace attachment {
+
+/**
+ * A pool of recycled @c InProcessSDS buffers for attachments.  Buffers are grouped into size classes (requested sizes
+ * rounded up to a multiple of @c SIZE_CLASS_GRANULARITY bytes).  When the last reference to a buffer acquired from
+ * the pool is released, the buffer is returned to the pool and handed out again by the next @c acquire() of the same
+ * size class, rather than being freed and reallocated.
+ *
+ * The pool holds on to at most @c maxPooledBytes of free buffers, and at most @c maxBuffersPerSizeClass free buffers
+ * of any one size class; buffers released beyond these limits are freed.  Buffers which are still in use when the
+ * pool is destroyed are freed when they are released.
+ *
+ * This class is thread safe.
+ */
+class AttachmentBufferPool : public std::enable_shared_from_this<AttachmentBufferPool> {
+public:
+    /// The type of buffer managed by this pool.
+    using Buffer = utils::sds::InProcessSDS::Buffer;
+
+    /// Requested buffer sizes are rounded up to a multiple of this many bytes.
+    static const size_t SIZE_CLASS_GRANULARITY = 4096;
+
+    /// The default limit on the total size (in bytes) of the free buffers held by the pool.
+    static const size_t DEFAULT_MAX_POOLED_BYTES = 4 * 1024 * 1024;
+
+    /// The default limit on the number of free buffers of any one size class held by the pool.
+    static const size_t DEFAULT_MAX_BUFFERS_PER_SIZE_CLASS = 4;
+
+    /**
+     * Creates an @c AttachmentBufferPool.
+     *
+     * @param maxPooledBytes The maximum total size (in bytes) of the free buffers held by the pool.
+     * @param maxBuffersPerSizeClass The maximum number of free buffers of any one size class held by the pool.
+     * @return The new pool, or @c nullptr if either limit is zero.
+     */
+    static std::shared_ptr<AttachmentBufferPool> create(
+        size_t maxPooledBytes = DEFAULT_MAX_POOLED_BYTES,
+        size_t maxBuffersPerSizeClass = DEFAULT_MAX_BUFFERS_PER_SIZE_CLASS);
+
+    /**
+     * Creates an @c AttachmentBufferPool using limits read from the @c attachmentManager node of the SDK
+     * configuration:
+     *
+     * @code{.json}
+     * "attachmentManager": {
+     *     // The maximum total size (in bytes) of free attachment buffers to keep for reuse.  Zero disables pooling.
+     *     "bufferPoolMaxBytes": 4194304,
+     *     // The maximum number of free attachment buffers of one size to keep for reuse.  Zero disables pooling.
+     *     "bufferPoolMaxBuffersPerSize": 4
+     * }
+     * @endcode
+     *
+     * Limits which are not configured use the defaults from @c create().
+     *
+     * @return The new pool, or @c nullptr if pooling is disabled by the configuration.
+     */
+    static std::shared_ptr<AttachmentBufferPool> createFromConfig();
+
+    /**
+     * Gets a buffer of at least @c size bytes, reusing a free buffer from the pool if one of the right size class is
+     * available.  The contents of a reused buffer are not cleared.
+     *
+     * @param size The minimum size (in bytes) of the buffer.
+     * @return A buffer of @c size bytes rounded up to its size class, which returns to the pool when released, or
+     *     @c nullptr if size is zero.
+     */
+    std::shared_ptr<Buffer> acquire(size_t size);
+
+    /**
+     * Returns the total size of the free buffers currently held by the pool.
+     *
+     * @return The total size (in bytes) of the free buffers in the pool.
+     */
+    size_t getPooledBytes() const;
+
+    /**
+     * Returns the number of free buffers currently held by the pool.
+     *
+     * @return The number of free buffers in the pool.
+     */
+    size_t getPooledBufferCount() const;
+
+private:
+    /**
+     * Constructor.
+     *
+     * @param maxPooledBytes The maximum total size (in bytes) of the free buffers held by the pool.
+     * @param maxBuffersPerSizeClass The maximum number of free buffers of any one size class held by the pool.
+     */
+    AttachmentBufferPool(size_t maxPooledBytes, size_t maxBuffersPerSizeClass);
+
+    /**
+     * Returns a buffer to the pool, or frees it if the pool is full.
+     *
+     * @param buffer The buffer to return.
+     */
+    void release(Buffer* buffer);
+
+    /// The maximum total size (in bytes) of the free buffers held by the pool.
+    const size_t m_maxPooledBytes;
+
+    /// The maximum number of free buffers of any one size class held by the pool.
+    const size_t m_maxBuffersPerSizeClass;
+
+    /// Serializes access to the members below.
+    mutable std::mutex m_mutex;
+
+    /// The free buffers, keyed by size class.
+    std::unordered_map<size_t, std::vector<std::unique_ptr<Buffer>>> m_freeBuffers;
+
+    /// The total size (in bytes) of the buffers in @c m_freeBuffers.
+    size_t m_pooledBytes;
+
+    /// The number of buffers in @c m_freeBuffers.
+    size_t m_pooledBufferCount;
+};
+
+}  // namespace attachment
+}  // namespace avs
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_AVS_INCLUDE_AVSCOMMON_AVS_ATTACHMENT_ATTACHMENTBUFFERPOOL_H_
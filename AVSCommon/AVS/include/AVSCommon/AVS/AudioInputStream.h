@@ -16,14 +16,27 @@
 #ifndef ALEXA_CLIENT_SDK_AVSCOMMON_AVS_INCLUDE_AVSCOMMON_AVS_AUDIOINPUTSTREAM_H_
 #define ALEXA_CLIENT_SDK_AVSCOMMON_AVS_INCLUDE_AVSCOMMON_AVS_AUDIOINPUTSTREAM_H_
 
+#ifdef SHARED_MEMORY_AUDIO_INPUT_STREAM
+#include "AVSCommon/Utils/SDS/SharedMemorySDS.h"
+#else
 #include "AVSCommon/Utils/SDS/InProcessSDS.h"
+#endif
 
 namespace alexaClientSDK {
 namespace avsCommon {
 namespace avs {
 
+#ifdef SHARED_MEMORY_AUDIO_INPUT_STREAM
+/**
+ * The type used store and stream binary data.  This stream is backed by POSIX shared memory, so a stream created on
+ * a named @c SharedMemoryBuffer can be opened from another process by mapping the buffer with
+ * @c SharedMemoryBuffer::open() and passing it to @c AudioInputStream::open().
+ */
+using AudioInputStream = utils::sds::SharedMemorySDS;
+#else
 /// The type used store and stream binary data.
 using AudioInputStream = utils::sds::InProcessSDS;
+#endif
 
 }  // namespace avs
 }  // namespace avsCommon
@@ -0,0 +1,150 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include "AVSCommon/AVS/Attachment/AttachmentBufferPool.h"
+
+#include "AVSCommon/Utils/Configuration/ConfigurationNode.h"
+#include "AVSCommon/Utils/Logger/Logger.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace avs {
+namespace attachment {
+
+using namespace alexaClientSDK::avsCommon::utils;
+
+/// String to identify log entries originating from this file.
+static const std::string TAG("AttachmentBufferPool");
+
+/**
+ * Create a LogEntry using this file's TAG and the specified event string.
+ *
+ * @param The event string for this @c LogEntry.
+ */
+#define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
+
+/// The key in our config file to find the root of attachment manager configuration.
+static const std::string ATTACHMENT_MANAGER_CONFIGURATION_ROOT_KEY = "attachmentManager";
+
+/// The key in our config file to find the maximum total size of free buffers in the pool.
+static const std::string BUFFER_POOL_MAX_BYTES_KEY = "bufferPoolMaxBytes";
+
+/// The key in our config file to find the maximum number of free buffers of one size in the pool.
+static const std::string BUFFER_POOL_MAX_BUFFERS_PER_SIZE_KEY = "bufferPoolMaxBuffersPerSize";
+
+// The definitions for these static class members.
+const size_t AttachmentBufferPool::SIZE_CLASS_GRANULARITY;
+const size_t AttachmentBufferPool::DEFAULT_MAX_POOLED_BYTES;
+const size_t AttachmentBufferPool::DEFAULT_MAX_BUFFERS_PER_SIZE_CLASS;
+
+std::shared_ptr<AttachmentBufferPool> AttachmentBufferPool::create(
+    size_t maxPooledBytes,
+    size_t maxBuffersPerSizeClass) {
+    if (0 == maxPooledBytes || 0 == maxBuffersPerSizeClass) {
+        ACSDK_DEBUG5(LX("createFailed")
+                         .d("reason", "poolingDisabled")
+                         .d("maxPooledBytes", maxPooledBytes)
+                         .d("maxBuffersPerSizeClass", maxBuffersPerSizeClass));
+        return nullptr;
+    }
+    return std::shared_ptr<AttachmentBufferPool>(new AttachmentBufferPool(maxPooledBytes, maxBuffersPerSizeClass));
+}
+
+std::shared_ptr<AttachmentBufferPool> AttachmentBufferPool::createFromConfig() {
+    auto config = configuration::ConfigurationNode::getRoot()[ATTACHMENT_MANAGER_CONFIGURATION_ROOT_KEY];
+    int maxPooledBytes = DEFAULT_MAX_POOLED_BYTES;
+    int maxBuffersPerSizeClass = DEFAULT_MAX_BUFFERS_PER_SIZE_CLASS;
+    config.getInt(BUFFER_POOL_MAX_BYTES_KEY, &maxPooledBytes, maxPooledBytes);
+    config.getInt(BUFFER_POOL_MAX_BUFFERS_PER_SIZE_KEY, &maxBuffersPerSizeClass, maxBuffersPerSizeClass);
+    if (maxPooledBytes < 0 || maxBuffersPerSizeClass < 0) {
+        ACSDK_ERROR(LX("createFromConfigFailed")
+                        .d("reason", "negativeLimit")
+                        .d("maxPooledBytes", maxPooledBytes)
+                        .d("maxBuffersPerSizeClass", maxBuffersPerSizeClass));
+        return nullptr;
+    }
+    return create(maxPooledBytes, maxBuffersPerSizeClass);
+}
+
+AttachmentBufferPool::AttachmentBufferPool(size_t maxPooledBytes, size_t maxBuffersPerSizeClass) :
+        m_maxPooledBytes{maxPooledBytes},
+        m_maxBuffersPerSizeClass{maxBuffersPerSizeClass},
+        m_pooledBytes{0},
+        m_pooledBufferCount{0} {
+}
+
+std::shared_ptr<AttachmentBufferPool::Buffer> AttachmentBufferPool::acquire(size_t size) {
+    if (0 == size) {
+        ACSDK_ERROR(LX("acquireFailed").d("reason", "zeroSize"));
+        return nullptr;
+    }
+    size_t sizeClass = ((size - 1) / SIZE_CLASS_GRANULARITY + 1) * SIZE_CLASS_GRANULARITY;
+
+    std::unique_ptr<Buffer> buffer;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_freeBuffers.find(sizeClass);
+        if (it != m_freeBuffers.end() && !it->second.empty()) {
+            buffer = std::move(it->second.back());
+            it->second.pop_back();
+            m_pooledBytes -= sizeClass;
+            --m_pooledBufferCount;
+        }
+    }
+    if (!buffer) {
+        buffer.reset(new Buffer(sizeClass));
+    }
+
+    // The deleter only holds a weak reference, so outstanding buffers don't keep the pool alive.
+    std::weak_ptr<AttachmentBufferPool> weakPool = shared_from_this();
+    return std::shared_ptr<Buffer>(buffer.release(), [weakPool](Buffer* released) {
+        auto pool = weakPool.lock();
+        if (pool) {
+            pool->release(released);
+        } else {
+            delete released;
+        }
+    });
+}
+
+size_t AttachmentBufferPool::getPooledBytes() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_pooledBytes;
+}
+
+size_t AttachmentBufferPool::getPooledBufferCount() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_pooledBufferCount;
+}
+
+void AttachmentBufferPool::release(Buffer* buffer) {
+    std::unique_ptr<Buffer> owned(buffer);
+    size_t sizeClass = owned->size();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto& freeBuffers = m_freeBuffers[sizeClass];
+    if (m_pooledBytes + sizeClass > m_maxPooledBytes || freeBuffers.size() >= m_maxBuffersPerSizeClass) {
+        // The pool is full, so let the buffer be freed.
+        return;
+    }
+    freeBuffers.push_back(std::move(owned));
+    m_pooledBytes += sizeClass;
+    ++m_pooledBufferCount;
+}
+
+}  // namespace attachment
+}  // namespace avs
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
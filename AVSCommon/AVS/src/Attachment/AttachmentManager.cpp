@@ -50,8 +50,11 @@ AttachmentManager::AttachmentManagementDetails::AttachmentManagementDetails() :
         creationTime{std::chrono::steady_clock::now()} {
 }
 
-AttachmentManager::AttachmentManager(AttachmentType attachmentType) :
+AttachmentManager::AttachmentManager(
+    AttachmentType attachmentType,
+    std::shared_ptr<AttachmentBufferPool> bufferPool) :
         m_attachmentType{attachmentType},
+        m_bufferPool{bufferPool},
         m_attachmentExpirationMinutes{ATTACHMENT_MANAGER_TIMOUT_MINUTES_DEFAULT} {
 }
 
@@ -99,7 +102,14 @@ AttachmentManager::AttachmentManagementDetails& AttachmentManager::getDetailsLoc
         switch (m_attachmentType) {
             // The in-process attachment type.
             case AttachmentType::IN_PROCESS:
-                details.attachment = make_unique<InProcessAttachment>(attachmentId);
+                if (m_bufferPool) {
+                    auto buffer = m_bufferPool->acquire(InProcessAttachment::SDSType::calculateBufferSize(
+                        InProcessAttachment::SDS_BUFFER_DEFAULT_SIZE_IN_BYTES));
+                    details.attachment = make_unique<InProcessAttachment>(
+                        attachmentId, InProcessAttachment::SDSType::create(buffer));
+                } else {
+                    details.attachment = make_unique<InProcessAttachment>(attachmentId);
+                }
                 break;
         }
 
@@ -0,0 +1,149 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "AVSCommon/AVS/Attachment/AttachmentBufferPool.h"
+#include "AVSCommon/AVS/Attachment/AttachmentManager.h"
+
+#include "Common/Common.h"
+
+using namespace alexaClientSDK::avsCommon::avs::attachment;
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace avs {
+namespace test {
+
+/// A buffer size which is not a multiple of the size class granularity.
+static const size_t TEST_BUFFER_SIZE = AttachmentBufferPool::SIZE_CLASS_GRANULARITY + 1;
+
+/// The size class of @c TEST_BUFFER_SIZE.
+static const size_t TEST_SIZE_CLASS = 2 * AttachmentBufferPool::SIZE_CLASS_GRANULARITY;
+
+/// A pool limit large enough to hold a few test buffers.
+static const size_t TEST_MAX_POOLED_BYTES = 3 * TEST_SIZE_CLASS;
+
+/// A per-size-class pool limit.
+static const size_t TEST_MAX_BUFFERS_PER_SIZE_CLASS = 2;
+
+/**
+ * Test that a pool can't be created with a zero limit.
+ */
+TEST(AttachmentBufferPoolTest, testCreateWithZeroLimits) {
+    ASSERT_EQ(AttachmentBufferPool::create(0, TEST_MAX_BUFFERS_PER_SIZE_CLASS), nullptr);
+    ASSERT_EQ(AttachmentBufferPool::create(TEST_MAX_POOLED_BYTES, 0), nullptr);
+    ASSERT_NE(AttachmentBufferPool::create(), nullptr);
+}
+
+/**
+ * Test that acquired buffers are rounded up to their size class, and that released buffers are reused.
+ */
+TEST(AttachmentBufferPoolTest, testBuffersAreRecycled) {
+    auto pool = AttachmentBufferPool::create(TEST_MAX_POOLED_BYTES, TEST_MAX_BUFFERS_PER_SIZE_CLASS);
+    ASSERT_NE(pool, nullptr);
+    ASSERT_EQ(pool->acquire(0), nullptr);
+
+    auto buffer = pool->acquire(TEST_BUFFER_SIZE);
+    ASSERT_NE(buffer, nullptr);
+    ASSERT_EQ(buffer->size(), TEST_SIZE_CLASS);
+    auto data = buffer->data();
+    ASSERT_EQ(pool->getPooledBufferCount(), 0U);
+
+    buffer.reset();
+    ASSERT_EQ(pool->getPooledBufferCount(), 1U);
+    ASSERT_EQ(pool->getPooledBytes(), TEST_SIZE_CLASS);
+
+    // A request in the same size class reuses the buffer.
+    buffer = pool->acquire(TEST_SIZE_CLASS);
+    ASSERT_EQ(buffer->data(), data);
+    ASSERT_EQ(pool->getPooledBufferCount(), 0U);
+    ASSERT_EQ(pool->getPooledBytes(), 0U);
+
+    // A request in a different size class does not.
+    buffer.reset();
+    auto smallBuffer = pool->acquire(1);
+    ASSERT_EQ(smallBuffer->size(), AttachmentBufferPool::SIZE_CLASS_GRANULARITY);
+    ASSERT_EQ(pool->getPooledBufferCount(), 1U);
+}
+
+/**
+ * Test that the pool does not hold more free buffers than its limits allow.
+ */
+TEST(AttachmentBufferPoolTest, testPoolLimits) {
+    auto pool = AttachmentBufferPool::create(TEST_MAX_POOLED_BYTES, TEST_MAX_BUFFERS_PER_SIZE_CLASS);
+    ASSERT_NE(pool, nullptr);
+
+    // The per-size-class limit applies first.
+    std::vector<std::shared_ptr<AttachmentBufferPool::Buffer>> buffers;
+    for (size_t i = 0; i < TEST_MAX_BUFFERS_PER_SIZE_CLASS + 1; ++i) {
+        buffers.push_back(pool->acquire(TEST_SIZE_CLASS));
+    }
+    buffers.clear();
+    ASSERT_EQ(pool->getPooledBufferCount(), TEST_MAX_BUFFERS_PER_SIZE_CLASS);
+
+    // Then the byte limit.
+    auto largeBuffer = pool->acquire(TEST_MAX_POOLED_BYTES);
+    largeBuffer.reset();
+    ASSERT_EQ(pool->getPooledBufferCount(), TEST_MAX_BUFFERS_PER_SIZE_CLASS);
+    ASSERT_LE(pool->getPooledBytes(), TEST_MAX_POOLED_BYTES);
+}
+
+/**
+ * Test that buffers which outlive their pool are still freed safely.
+ */
+TEST(AttachmentBufferPoolTest, testBufferOutlivesPool) {
+    auto pool = AttachmentBufferPool::create(TEST_MAX_POOLED_BYTES, TEST_MAX_BUFFERS_PER_SIZE_CLASS);
+    ASSERT_NE(pool, nullptr);
+    auto buffer = pool->acquire(TEST_BUFFER_SIZE);
+    pool.reset();
+    buffer.reset();
+}
+
+/**
+ * Test that an @c AttachmentManager with a pool recycles the buffer of an attachment once its reader and writer are
+ * released.
+ */
+TEST(AttachmentBufferPoolTest, testAttachmentManagerRecyclesBuffers) {
+    auto pool = AttachmentBufferPool::create();
+    ASSERT_NE(pool, nullptr);
+    AttachmentManager manager(AttachmentManager::AttachmentType::IN_PROCESS, pool);
+
+    for (int i = 0; i < 2; ++i) {
+        auto writer = manager.createWriter(TEST_ATTACHMENT_ID_STRING_ONE);
+        auto reader = manager.createReader(TEST_ATTACHMENT_ID_STRING_ONE, utils::sds::ReaderPolicy::NONBLOCKING);
+        ASSERT_NE(writer, nullptr);
+        ASSERT_NE(reader, nullptr);
+
+        AttachmentWriter::WriteStatus writeStatus;
+        char data[TEST_SDS_PARTIAL_WRITE_AMOUNT_IN_BYTES] = {'a'};
+        ASSERT_EQ(writer->write(data, sizeof(data), &writeStatus), sizeof(data));
+        AttachmentReader::ReadStatus readStatus;
+        char readData[TEST_SDS_PARTIAL_WRITE_AMOUNT_IN_BYTES];
+        ASSERT_EQ(reader->read(readData, sizeof(readData), &readStatus), sizeof(readData));
+        ASSERT_EQ(readData[0], 'a');
+
+        // The buffer is still in use by the attachment, so only a previously recycled buffer can be in the pool.
+        ASSERT_EQ(pool->getPooledBufferCount(), 0U);
+        writer.reset();
+        reader.reset();
+        ASSERT_EQ(pool->getPooledBufferCount(), 1U);
+    }
+}
+
+}  // namespace test
+}  // namespace avs
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
@@ -16,6 +16,7 @@
 #ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_SDS_BUFFERLAYOUT_H_
 #define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_SDS_BUFFERLAYOUT_H_
 
+#include <chrono>
 #include <cstdint>
 #include <cstddef>
 #include <mutex>
@@ -32,9 +33,18 @@ namespace sds {
 
 /**
  * This is a nested class inside @c SharedDatastream which defines the layout of a @c Buffer for use with a
- * @c SharedDataStream.  This layout begins with a fixed @c Header structure, followed by two arrays of
- * @c Reader @c Indexes, with the remainder allocated to data.  All four of these sections are aligned on a 64-bit
- * boundary.
+ * @c SharedDataStream.  This layout begins with a fixed @c Header structure, followed by the per-@c Reader state
+ * (an enabled flag, three @c Indexes and a condition variable for each @c Reader), followed by an optional ring of
+ * capture timestamps (see @c recordTimestamps()), with the remainder allocated to data.
+ *
+ * The per-@c Reader state can be laid out in one of two ways (see @c SharedDataStream::Layout):
+ * @li @c Layout::PACKED stores each per-@c Reader field in its own array, with each array aligned to the natural
+ *     alignment of its type.  This minimizes the size of the @c Buffer.  The @c Header::version of a packed
+ *     @c Buffer is @c VERSION.
+ * @li @c Layout::PADDED groups the fields of each @c Reader into a slot, and pads the slots so that no two
+ *     @c Readers (and no @c Reader and the @c Header) ever share a cache line, regardless of the alignment of the
+ *     @c Buffer.  This avoids false sharing when @c Readers run on different cores.  The @c Header::version of a
+ *     padded @c Buffer is @c PADDED_VERSION.
  */
 template <typename T>
 class SharedDataStream<T>::BufferLayout {
@@ -42,8 +52,14 @@ public:
     /// Magic number used to identify a valid Header in memory.
     static const uint32_t MAGIC_NUMBER = 0x53445348;
 
-    /// Version of this header layout.
-    static const uint32_t VERSION = 2;
+    /// Version of this header layout, when the per-@c Reader state is packed.
+    static const uint32_t VERSION = 6;
+
+    /// Version of this header layout, when the per-@c Reader state is padded to cache lines.
+    static const uint32_t PADDED_VERSION = 7;
+
+    /// The cache line size (in bytes) assumed when padding shared state to avoid false sharing.
+    static const size_t CACHE_LINE_SIZE = 64;
 
     /**
      * The constructor only initializes a shared pointer to the provided buffer.  Attaching and/or initializing is
@@ -95,10 +111,19 @@ public:
          */
         uint8_t maxReaders;
 
-        /// This field contains the condition variable used to notify @c Readers that data is available.
-        ConditionVariable dataAvailableConditionVariable;
+        /**
+         * This field specifies the number of words covered by each capture timestamp, or zero if the stream does not
+         * record capture timestamps.
+         */
+        uint32_t timestampBlockWords;
 
-        /// This field contains the mutex used by @c dataAvailableConditionVariable.
+        /// This field specifies the number of capture timestamps in the ring which follows the per-@c Reader state.
+        uint64_t timestampSlotCount;
+
+        /**
+         * This field contains the mutex used by the per-reader condition variables (see
+         * @c getReaderConditionVariable()) to notify @c Readers that data is available.
+         */
         Mutex dataAvailableMutex;
 
         /**
@@ -127,6 +152,12 @@ public:
          */
         Mutex writerEnableMutex;
 
+        /**
+         * This field keeps the @c Writer cursors below from sharing a cache line with the preceding fields,
+         * regardless of the alignment of the @c Buffer.
+         */
+        uint8_t writeCursorsLeadingPadding[CACHE_LINE_SIZE];
+
         /// This field contains the next location to write to.
         AtomicIndex writeStartCursor;
 
@@ -136,6 +167,12 @@ public:
          */
         AtomicIndex writeEndCursor;
 
+        /**
+         * This field keeps the @c Writer cursors above from sharing a cache line with the following fields
+         * (in particular, @c oldestUnconsumedCursor, which is updated by the @c Readers).
+         */
+        uint8_t writeCursorsTrailingPadding[CACHE_LINE_SIZE];
+
         /**
          * This field contains the location of oldest word in the buffer which has not been consumed (read by a
          * @c Reader).  This field is used as a barrier by @c Writers which have a policy not to overwrite readers.
@@ -166,30 +203,20 @@ public:
     Header* getHeader() const;
 
     /**
-     * This function provides access to the array of booleans which specify whether a particular reader is enabled.
-     *
-     * This array of enabled booleans comes next in @c m_buffer after the @c Header.
-     *
-     * @return A pointer to the array of @c maxReaders cursor @c Indexes.
-     */
-    AtomicBool* getReaderEnabledArray() const;
-
-    /**
-     * This function provides access to the array of indices which specify the location each @c Reader will read from.
-     *
-     * This array of cursor indices comes next in @c m_buffer after the @c getReaderEnabledArray() listed above.
+     * This function provides access to the index which specifies the location a @c Reader will read from.
      *
-     * @return A pointer to the array of @c maxReaders cursor @c Indexes.
+     * @param id The id of the @c Reader.
+     * @return A pointer to the cursor @c Index of the specified @c Reader.
      */
-    AtomicIndex* getReaderCursorArray() const;
+    AtomicIndex* getReaderCursor(size_t id) const;
 
     /**
-     * This function provides access to the array of indices which specify the @c Index where each @c Reader
-     * will stop reading.  When a @c Reader's close @c Index is set to zero, this indicates that the @c Reader is
-     * disabled.  When a @c Reader's close @c Index is less than or equal to the @c Reader's cursor, this
-     * indicates that the @c Reader has reached the end of its stream, and subsequent calls to @c Reader::read() will
-     * return 0.  When a @c Reader's close @c Index is greater than the @c Reader's cursor, the @c Reader will continue
-     * to return data as it becomes available in the stream up to the point when it reaches the close @c Index.
+     * This function provides access to the index which specifies the @c Index where a @c Reader will stop reading.
+     * When a @c Reader's close @c Index is set to zero, this indicates that the @c Reader is disabled.  When a
+     * @c Reader's close @c Index is less than or equal to the @c Reader's cursor, this indicates that the @c Reader
+     * has reached the end of its stream, and subsequent calls to @c Reader::read() will return 0.  When a @c Reader's
+     * close @c Index is greater than the @c Reader's cursor, the @c Reader will continue to return data as it becomes
+     * available in the stream up to the point when it reaches the close @c Index.
      *
      * @note An enabled @c Reader will initially have its close @c Index set to
      *     @c std::numeric_limits_max<AtomicIndex>, meaning it can effectively continue to read indefinitely, until the
@@ -197,15 +224,33 @@ public:
      *     the current write start cursor, which will cause the read stream to end when the @c Reader finishes
      *     consuming the data that was in the buffer at the time @c Reader::close() was called.
      *
-     * This array of close @c Index indices comes next in @c m_buffer after the @c getReaderCursorArray() listed above.
+     * @param id The id of the @c Reader.
+     * @return A pointer to the close @c Index of the specified @c Reader.
+     */
+    AtomicIndex* getReaderCloseIndex(size_t id) const;
+
+    /**
+     * This function provides access to the index which specifies the @c Index a blocked @c Reader is waiting for the
+     * @c Writer to reach before it should be woken up.  A @c Reader which is not blocked has its wakeup @c Index set
+     * to @c std::numeric_limits<Index>::max().
+     *
+     * @param id The id of the @c Reader.
+     * @return A pointer to the wakeup @c Index of the specified @c Reader.
+     */
+    AtomicIndex* getReaderWakeupIndex(size_t id) const;
+
+    /**
+     * This function provides access to the condition variable used to notify a @c Reader that the data it is waiting
+     * for is available.  This condition variable is used with @c Header::dataAvailableMutex.
      *
-     * @return A pointer to the array of @c maxReaders close @c Indexes.
+     * @param id The id of the @c Reader.
+     * @return A pointer to the condition variable of the specified @c Reader.
      */
-    AtomicIndex* getReaderCloseIndexArray() const;
+    ConditionVariable* getReaderConditionVariable(size_t id) const;
 
     /**
      * This function returns the size (in words) of the data (non-Header) portion of @c buffer.  The data comes next in
-     * @c m_buffer after the @c getReaderCloseIndexarray() listed above.
+     * @c m_buffer after the per-@c Reader state.
      *
      * @return The maximum number of words the stream can store.
      */
@@ -214,7 +259,7 @@ public:
     /**
      * This function provides access to the data (non-Header) portion of @c buffer.
      *
-     * The data comes next in @c m_buffer after the @c getReaderCloseIndexArray() array listed above.
+     * The data comes next in @c m_buffer after the per-@c Reader state.
      *
      * @param at An optional word @c Index to get a data pointer for.  This function will calculate where @c at would
      *     fall in the circular buffer and return a pointer to it, but note that this function does not check whether
@@ -224,6 +269,39 @@ public:
      */
     uint8_t* getData(Index at = 0) const;
 
+    /**
+     * This function returns the number of words covered by each capture timestamp.
+     *
+     * @return The number of words covered by each capture timestamp, or zero if the stream does not record capture
+     *     timestamps.
+     */
+    size_t getTimestampBlockWords() const;
+
+    /**
+     * This function records the capture time of a range of words which is about to be published by the @c Writer.
+     * The stream is divided into blocks of @c Header::timestampBlockWords words, and each block whose first word
+     * falls in the range is tagged with the range's @c begin @c Index and @c captureTime.  This function must be
+     * called before @c Header::writeStartCursor is moved past @c end, so that @c Readers never see data without its
+     * timestamp.  This function does nothing if the stream does not record capture timestamps.
+     *
+     * @param begin The @c Index of the first word in the range.
+     * @param end The @c Index after the last word in the range.
+     * @param captureTime The capture time of the word at @c begin.
+     */
+    void recordTimestamps(Index begin, Index end, std::chrono::steady_clock::time_point captureTime);
+
+    /**
+     * This function looks up the capture timestamp which was recorded for the block containing the specified
+     * @c Index.
+     *
+     * @param at The @c Index to look up.
+     * @param[out] timestamp The @c Index and capture time passed to @c recordTimestamps() for the range which
+     *     contained the first word of the block containing @c at.
+     * @return @c true if a timestamp is available, or @c false if the stream does not record capture timestamps, or
+     *     @c at has not been written yet or has been overwritten.
+     */
+    bool getTimestamp(Index at, Timestamp* timestamp) const;
+
     /**
      * This function initalizes the @c Header and arrays in the @c Buffer managed by this @c BufferLayout.
      * This function must not be called on a @c BufferLayout which is managing a @c Buffer which has already been
@@ -234,9 +312,12 @@ public:
      * @param wordSize The size (in bytes) of words in the stream.  All @c SharedDataStream operations that work with
      *     data or position in the stream are quantified in words.
      * @param maxReaders The maximum number of readers the stream will support.
-     * @return @c false if wordSize or maxReaders are too large to be stored, else @c true.
+     * @param layout The @c Layout to use for the per-@c Reader state.
+     * @param timestampBlockWords The number of words covered by each capture timestamp, or zero to disable capture
+     *     timestamps.
+     * @return @c false if wordSize, maxReaders or timestampBlockWords are too large to be stored, else @c true.
      */
-    bool init(size_t wordSize, size_t maxReaders);
+    bool init(size_t wordSize, size_t maxReaders, Layout layout, size_t timestampBlockWords);
 
     /**
      * This function tries to attach this @c BufferLayout to a @c Buffer which was already initialized by another
@@ -297,9 +378,31 @@ public:
      * @param wordSize The size (in bytes) of words in the stream.  All @c SharedDataStream operations that work with
      *     data or position in the stream are quantified in words.
      * @param maxReaders The maximum number of readers the stream will support.
+     * @param layout The @c Layout to use for the per-@c Reader state.
+     * @param timestampSlotCount The number of capture timestamps in the ring which precedes the circular data.
      * @return The offset (in bytes) from the start of a @c Buffer to the start of the circular data.
      */
-    static size_t calculateDataOffset(size_t wordSize, size_t maxReaders);
+    static size_t calculateDataOffset(size_t wordSize, size_t maxReaders, Layout layout, size_t timestampSlotCount);
+
+    /**
+     * This function calculates the number of capture timestamps needed to cover the circular data in a @c Buffer of
+     * the specified size.  This is the smallest count for which `(count * timestampBlockWords)` is at least the
+     * number of words left over for the circular data.
+     *
+     * @param bufferSize The size (in bytes) of the @c Buffer.
+     * @param wordSize The size (in bytes) of words in the stream.
+     * @param maxReaders The maximum number of readers the stream will support.
+     * @param layout The @c Layout to use for the per-@c Reader state.
+     * @param timestampBlockWords The number of words covered by each capture timestamp, or zero if capture
+     *     timestamps are disabled.
+     * @return The number of capture timestamps needed.
+     */
+    static size_t calculateTimestampSlotCount(
+        size_t bufferSize,
+        size_t wordSize,
+        size_t maxReaders,
+        Layout layout,
+        size_t timestampBlockWords);
 
     /// This function calls @c updateOldestUnconsumedCursorLocked() while holding @c Header::backwardSeekMutex.
     void updateOldestUnconsumedCursor();
@@ -328,6 +431,23 @@ public:
      */
     void updateOldestUnconsumedCursorLocked();
 
+    /**
+     * This function wakes up any blocked @c Readers whose wakeup @c Index has been reached by the @c Writer.  This
+     * function should be called whenever the @c Writer moves @c Header::writeStartCursor.
+     *
+     * @note To avoid contending with @c Readers on every write, @c Header::dataAvailableMutex is only locked when at
+     *     least one @c Reader needs to be woken up.  This is safe because a @c Reader publishes its wakeup @c Index
+     *     before checking @c Header::writeStartCursor, and this function is called after @c Header::writeStartCursor
+     *     has been published, so at least one of them is guaranteed to observe the other's update.
+     */
+    void notifyReaders();
+
+    /**
+     * This function wakes up all blocked @c Readers, regardless of their wakeup @c Index.  This is used when the
+     * state of the stream changes in a way other than new data arriving (for example, when the @c Writer closes).
+     */
+    void notifyAllReaders();
+
 private:
     /**
      * This function calculates a 32-bit stable hash of the provided string.  Note that this hash is just used for
@@ -347,31 +467,74 @@ private:
      */
     static size_t alignSizeTo(size_t size, size_t align);
 
+    /// This structure holds one entry in the ring of capture timestamps.
+    struct TimestampSlot {
+        /**
+         * The @c Index passed to @c recordTimestamps() for the range containing the first word of this slot's block,
+         * or @c std::numeric_limits<Index>::max() while the slot is being updated.
+         */
+        AtomicIndex index;
+
+        /// The capture time of @c index, in nanoseconds since the epoch of @c std::chrono::steady_clock.
+        AtomicIndex captureTime;
+    };
+
+    /// This structure describes where the per-@c Reader state is located in a @c Buffer.
+    struct ReaderStateLayout {
+        /// The offset (in bytes) from the start of the @c Buffer to the enabled flag of the first @c Reader.
+        size_t enabledOffset;
+
+        /// The offset (in bytes) from the start of the @c Buffer to the cursor of the first @c Reader.
+        size_t cursorOffset;
+
+        /// The offset (in bytes) from the start of the @c Buffer to the close @c Index of the first @c Reader.
+        size_t closeIndexOffset;
+
+        /// The offset (in bytes) from the start of the @c Buffer to the wakeup @c Index of the first @c Reader.
+        size_t wakeupIndexOffset;
+
+        /// The offset (in bytes) from the start of the @c Buffer to the condition variable of the first @c Reader.
+        size_t conditionVariableOffset;
+
+        /**
+         * The distance (in bytes) between the fields of consecutive @c Readers, or zero if each field is stored in a
+         * packed array (in which case the distance is the size of the field).
+         */
+        size_t slotStride;
+
+        /// The offset (in bytes) from the start of the @c Buffer to the end of the per-@c Reader state.
+        size_t endOffset;
+    };
+
     /**
-     * This function calculates the offset (in bytes) from the start of a @c Buffer to the start of the @c Reader
-     * enabled array.
+     * This function calculates where the per-@c Reader state is located in a @c Buffer.
      *
-     * @return The offset (in bytes) from the start of a @c Buffer to the start of the @c Reader enabled array.
+     * @param maxReaders The maximum number of readers the stream will support.
+     * @param layout The @c Layout to use for the per-@c Reader state.
+     * @return The location of the per-@c Reader state.
      */
-    static size_t calculateReaderEnabledArrayOffset();
+    static ReaderStateLayout calculateReaderStateLayout(size_t maxReaders, Layout layout);
 
     /**
-     * This function calculates the offset (in bytes) from the start of a @c Buffer to the start of the @c Reader
-     * cursor array.
+     * This function converts a @c Header::version to the @c Layout it describes.
      *
-     * @param maxReaders The maximum number of readers the stream will support.
-     * @return The offset (in bytes) from the start of a @c Buffer to the start of the @c Reader cursor array.
+     * @param version The @c Header::version to convert.
+     * @param[out] layout The @c Layout described by @c version.
+     * @return @c true if @c version is supported, else @c false.
      */
-    static size_t calculateReaderCursorArrayOffset(size_t maxReaders);
+    static bool versionToLayout(uint32_t version, Layout* layout);
 
     /**
-     * This function calculates the offset (in bytes) from the start of a @c Buffer to the start of the @c Reader
-     * close @c Index array.
+     * This function provides access to a per-@c Reader field.
      *
-     * @param maxReaders The maximum number of readers the stream will support.
-     * @return The offset (in bytes) from the start of a @c Buffer to the start of the @c Reader close @c Index array.
+     * @tparam FieldType The type of the field.
+     * @param base A pointer to the field of the first @c Reader.
+     * @param stride The distance (in bytes) between the fields of consecutive @c Readers.
+     * @param id The id of the @c Reader.
+     * @return A pointer to the field of the specified @c Reader.
      */
-    static size_t calculateReaderCloseIndexArrayOffset(size_t maxReaders);
+    template <typename FieldType>
+    static FieldType* getReaderField(uint8_t* base, size_t stride, size_t id);
 
     /**
      * This function calculates several frequently-accessed constants and caches them in member variables.
@@ -379,8 +542,10 @@ private:
      * @param wordSize The size (in bytes) of words in the stream.  All @c SharedDataStream operations that work with
      *     data or position in the stream are quantified in words.
      * @param maxReaders The maximum number of readers the stream will support.
+     * @param layout The @c Layout of the per-@c Reader state.
+     * @param timestampSlotCount The number of capture timestamps in the ring which precedes the circular data.
      */
-    void calculateAndCacheConstants(size_t wordSize, size_t maxReaders);
+    void calculateAndCacheConstants(size_t wordSize, size_t maxReaders, Layout layout, size_t timestampSlotCount);
 
     /**
      * The tag associated with log entries from this class.
@@ -397,14 +562,38 @@ private:
     /// The @c Buffer used to store the stream's header and data.
     std::shared_ptr<Buffer> m_buffer;
 
-    /// Precalculated pointer to the @c Reader enabled array.
-    AtomicBool* m_readerEnabledArray;
+    /// Precalculated pointer to the first @c Reader enabled flag.
+    uint8_t* m_readerEnabledBase;
+
+    /// Precalculated distance between consecutive @c Reader enabled flags.
+    size_t m_readerEnabledStride;
+
+    /// Precalculated pointer to the first @c Reader cursor.
+    uint8_t* m_readerCursorBase;
+
+    /// Precalculated distance between consecutive @c Reader cursors.
+    size_t m_readerCursorStride;
 
-    /// Precalculated pointer to the @c Reader cursor array.
-    AtomicIndex* m_readerCursorArray;
+    /// Precalculated pointer to the first @c Reader close @c Index.
+    uint8_t* m_readerCloseIndexBase;
 
-    /// Precalculated pointer to the @c Reader close @c Index array.
-    AtomicIndex* m_readerCloseIndexArray;
+    /// Precalculated distance between consecutive @c Reader close @c Indexes.
+    size_t m_readerCloseIndexStride;
+
+    /// Precalculated pointer to the first @c Reader wakeup @c Index.
+    uint8_t* m_readerWakeupIndexBase;
+
+    /// Precalculated distance between consecutive @c Reader wakeup @c Indexes.
+    size_t m_readerWakeupIndexStride;
+
+    /// Precalculated pointer to the first @c Reader condition variable.
+    uint8_t* m_readerConditionVariableBase;
+
+    /// Precalculated distance between consecutive @c Reader condition variables.
+    size_t m_readerConditionVariableStride;
+
+    /// Precalculated pointer to the ring of capture timestamps.
+    TimestampSlot* m_timestampSlots;
 
     /// Precalculated size (in words) of the circular data.
     Index m_dataSize;
@@ -419,9 +608,17 @@ const std::string SharedDataStream<T>::BufferLayout::TAG = "SdsBufferLayout";
 template <typename T>
 SharedDataStream<T>::BufferLayout::BufferLayout(std::shared_ptr<Buffer> buffer) :
         m_buffer{buffer},
-        m_readerEnabledArray{nullptr},
-        m_readerCursorArray{nullptr},
-        m_readerCloseIndexArray{nullptr},
+        m_readerEnabledBase{nullptr},
+        m_readerEnabledStride{0},
+        m_readerCursorBase{nullptr},
+        m_readerCursorStride{0},
+        m_readerCloseIndexBase{nullptr},
+        m_readerCloseIndexStride{0},
+        m_readerWakeupIndexBase{nullptr},
+        m_readerWakeupIndexStride{0},
+        m_readerConditionVariableBase{nullptr},
+        m_readerConditionVariableStride{0},
+        m_timestampSlots{nullptr},
         m_dataSize{0},
         m_data{nullptr} {
 }
@@ -437,18 +634,24 @@ typename SharedDataStream<T>::BufferLayout::Header* SharedDataStream<T>::BufferL
 }
 
 template <typename T>
-typename SharedDataStream<T>::AtomicBool* SharedDataStream<T>::BufferLayout::getReaderEnabledArray() const {
-    return m_readerEnabledArray;
+typename SharedDataStream<T>::AtomicIndex* SharedDataStream<T>::BufferLayout::getReaderCursor(size_t id) const {
+    return getReaderField<AtomicIndex>(m_readerCursorBase, m_readerCursorStride, id);
 }
 
 template <typename T>
-typename SharedDataStream<T>::AtomicIndex* SharedDataStream<T>::BufferLayout::getReaderCursorArray() const {
-    return m_readerCursorArray;
+typename SharedDataStream<T>::AtomicIndex* SharedDataStream<T>::BufferLayout::getReaderCloseIndex(size_t id) const {
+    return getReaderField<AtomicIndex>(m_readerCloseIndexBase, m_readerCloseIndexStride, id);
 }
 
 template <typename T>
-typename SharedDataStream<T>::AtomicIndex* SharedDataStream<T>::BufferLayout::getReaderCloseIndexArray() const {
-    return m_readerCloseIndexArray;
+typename SharedDataStream<T>::AtomicIndex* SharedDataStream<T>::BufferLayout::getReaderWakeupIndex(size_t id) const {
+    return getReaderField<AtomicIndex>(m_readerWakeupIndexBase, m_readerWakeupIndexStride, id);
+}
+
+template <typename T>
+typename SharedDataStream<T>::ConditionVariable* SharedDataStream<T>::BufferLayout::getReaderConditionVariable(
+    size_t id) const {
+    return getReaderField<ConditionVariable>(m_readerConditionVariableBase, m_readerConditionVariableStride, id);
 }
 
 template <typename T>
@@ -462,7 +665,67 @@ uint8_t* SharedDataStream<T>::BufferLayout::getData(Index at) const {
 }
 
 template <typename T>
-bool SharedDataStream<T>::BufferLayout::init(size_t wordSize, size_t maxReaders) {
+size_t SharedDataStream<T>::BufferLayout::getTimestampBlockWords() const {
+    return getHeader()->timestampBlockWords;
+}
+
+template <typename T>
+void SharedDataStream<T>::BufferLayout::recordTimestamps(
+    Index begin,
+    Index end,
+    std::chrono::steady_clock::time_point captureTime) {
+    auto header = getHeader();
+    Index blockWords = header->timestampBlockWords;
+    if (0 == blockWords) {
+        return;
+    }
+
+    auto nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(captureTime.time_since_epoch()).count();
+    for (Index block = (begin + blockWords - 1) / blockWords; block * blockWords < end; ++block) {
+        auto& slot = m_timestampSlots[block % header->timestampSlotCount];
+        // Invalidate the slot while it is being updated so that getTimestamp() never pairs an index with the wrong
+        // capture time.
+        slot.index = std::numeric_limits<Index>::max();
+        slot.captureTime = nanoseconds;
+        slot.index = begin;
+    }
+}
+
+template <typename T>
+bool SharedDataStream<T>::BufferLayout::getTimestamp(Index at, Timestamp* timestamp) const {
+    auto header = getHeader();
+    Index blockWords = header->timestampBlockWords;
+    if (0 == blockWords || nullptr == timestamp) {
+        return false;
+    }
+
+    Index writeStartCursor = header->writeStartCursor;
+    if (at >= writeStartCursor || writeStartCursor - at > getDataSize()) {
+        return false;
+    }
+
+    Index blockBegin = at - (at % blockWords);
+    auto& slot = m_timestampSlots[(at / blockWords) % header->timestampSlotCount];
+    Index index = slot.index;
+    Index captureTime = slot.captureTime;
+    // A single write never spans more than the data size, so an index further back than that must belong to an
+    // earlier pass through the ring.
+    if (index != slot.index || index > blockBegin || blockBegin - index >= getDataSize()) {
+        return false;
+    }
+
+    timestamp->index = index;
+    timestamp->captureTime = std::chrono::steady_clock::time_point(
+        std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::nanoseconds(captureTime)));
+    return true;
+}
+
+template <typename T>
+bool SharedDataStream<T>::BufferLayout::init(
+    size_t wordSize,
+    size_t maxReaders,
+    Layout layout,
+    size_t timestampBlockWords) {
     // Make sure parameters are not too large to store.
     if (wordSize > std::numeric_limits<decltype(Header::wordSize)>::max()) {
         logger::acsdkError(logger::LogEntry(TAG, "initFailed")
@@ -478,27 +741,46 @@ bool SharedDataStream<T>::BufferLayout::init(size_t wordSize, size_t maxReaders)
                                .d("maxReadersLimit", std::numeric_limits<decltype(Header::maxReaders)>::max()));
         return false;
     }
+    if (timestampBlockWords > std::numeric_limits<decltype(Header::timestampBlockWords)>::max()) {
+        logger::acsdkError(
+            logger::LogEntry(TAG, "initFailed")
+                .d("reason", "timestampBlockWordsTooLarge")
+                .d("timestampBlockWords", timestampBlockWords)
+                .d("timestampBlockWordsLimit", std::numeric_limits<decltype(Header::timestampBlockWords)>::max()));
+        return false;
+    }
 
     // Pre-calculate some pointers and sizes that are frequently accessed.
-    calculateAndCacheConstants(wordSize, maxReaders);
+    size_t timestampSlotCount =
+        calculateTimestampSlotCount(m_buffer->size(), wordSize, maxReaders, layout, timestampBlockWords);
+    calculateAndCacheConstants(wordSize, maxReaders, layout, timestampSlotCount);
 
     // Default construction of the Header.
     auto header = new (getHeader()) Header;
 
-    // Default construction of the reader arrays.
+    // Default construction of the per-reader state.
     size_t id;
     for (id = 0; id < maxReaders; ++id) {
-        new (m_readerEnabledArray + id) AtomicBool;
-        new (m_readerCursorArray + id) AtomicIndex;
-        new (m_readerCloseIndexArray + id) AtomicIndex;
+        new (getReaderField<AtomicBool>(m_readerEnabledBase, m_readerEnabledStride, id)) AtomicBool;
+        new (getReaderCursor(id)) AtomicIndex;
+        new (getReaderCloseIndex(id)) AtomicIndex;
+        new (getReaderWakeupIndex(id)) AtomicIndex;
+        new (getReaderConditionVariable(id)) ConditionVariable;
+    }
+
+    // Default construction of the timestamp ring.
+    for (size_t slot = 0; slot < timestampSlotCount; ++slot) {
+        new (m_timestampSlots + slot) TimestampSlot;
     }
 
     // Header field initialization.
     header->magic = MAGIC_NUMBER;
-    header->version = VERSION;
+    header->version = (Layout::PADDED == layout) ? PADDED_VERSION : VERSION;
     header->traitsNameHash = stableHash(T::traitsName);
     header->wordSize = wordSize;
     header->maxReaders = maxReaders;
+    header->timestampBlockWords = timestampBlockWords;
+    header->timestampSlotCount = timestampSlotCount;
     header->isWriterEnabled = false;
     header->hasWriterBeenClosed = false;
     header->writeStartCursor = 0;
@@ -506,11 +788,18 @@ bool SharedDataStream<T>::BufferLayout::init(size_t wordSize, size_t maxReaders)
     header->oldestUnconsumedCursor = 0;
     header->referenceCount = 1;
 
-    // Reader arrays initialization.
+    // Per-reader state initialization.
     for (id = 0; id < maxReaders; ++id) {
-        m_readerEnabledArray[id] = false;
-        m_readerCursorArray[id] = 0;
-        m_readerCloseIndexArray[id] = 0;
+        *getReaderField<AtomicBool>(m_readerEnabledBase, m_readerEnabledStride, id) = false;
+        *getReaderCursor(id) = 0;
+        *getReaderCloseIndex(id) = 0;
+        *getReaderWakeupIndex(id) = std::numeric_limits<Index>::max();
+    }
+
+    // Timestamp ring initialization.
+    for (size_t slot = 0; slot < timestampSlotCount; ++slot) {
+        m_timestampSlots[slot].index = std::numeric_limits<Index>::max();
+        m_timestampSlots[slot].captureTime = 0;
     }
 
     return true;
@@ -527,11 +816,13 @@ bool SharedDataStream<T>::BufferLayout::attach() {
                                .d("expectedMagicNumber", std::to_string(MAGIC_NUMBER)));
         return false;
     }
-    if (header->version != VERSION) {
+    Layout layout;
+    if (!versionToLayout(header->version, &layout)) {
         logger::acsdkError(logger::LogEntry(TAG, "attachFailed")
                                .d("reason", "incompatibleVersion")
                                .d("version", header->version)
-                               .d("expectedVersion", std::to_string(VERSION)));
+                               .d("expectedVersion", std::to_string(VERSION))
+                               .d("expectedPaddedVersion", std::to_string(PADDED_VERSION)));
         return false;
     }
     if (header->traitsNameHash != stableHash(T::traitsName)) {
@@ -558,7 +849,7 @@ bool SharedDataStream<T>::BufferLayout::attach() {
     ++header->referenceCount;
 
     // Pre-calculate some pointers and sizes that are frequently accessed.
-    calculateAndCacheConstants(header->wordSize, header->maxReaders);
+    calculateAndCacheConstants(header->wordSize, header->maxReaders, layout, header->timestampSlotCount);
 
     return true;
 }
@@ -570,17 +861,29 @@ void SharedDataStream<T>::BufferLayout::detach() {
     }
 
     auto header = getHeader();
-    std::lock_guard<Mutex> lock(header->attachMutex);
-    --header->referenceCount;
-    if (header->referenceCount > 0) {
-        return;
+    {
+        std::lock_guard<Mutex> lock(header->attachMutex);
+        --header->referenceCount;
+        if (header->referenceCount > 0) {
+            return;
+        }
+    }
+
+    // This was the last BufferLayout attached, so nothing else can be using the Buffer.  The destructors must be
+    // called after attachMutex is unlocked, since destroying a locked mutex is undefined behavior.
+
+    // Destruction of the timestamp ring.
+    for (size_t slot = 0; slot < header->timestampSlotCount; ++slot) {
+        m_timestampSlots[slot].~TimestampSlot();
     }
 
-    // Destruction of reader arrays.
+    // Destruction of the per-reader state.
     for (size_t id = 0; id < header->maxReaders; ++id) {
-        m_readerCloseIndexArray[id].~AtomicIndex();
-        m_readerCursorArray[id].~AtomicIndex();
-        m_readerEnabledArray[id].~AtomicBool();
+        getReaderConditionVariable(id)->~ConditionVariable();
+        getReaderWakeupIndex(id)->~AtomicIndex();
+        getReaderCloseIndex(id)->~AtomicIndex();
+        getReaderCursor(id)->~AtomicIndex();
+        getReaderField<AtomicBool>(m_readerEnabledBase, m_readerEnabledStride, id)->~AtomicBool();
     }
 
     // Destruction of the Header.
@@ -589,27 +892,63 @@ void SharedDataStream<T>::BufferLayout::detach() {
 
 template <typename T>
 bool SharedDataStream<T>::BufferLayout::isReaderEnabled(size_t id) const {
-    return m_readerEnabledArray[id];
+    return *getReaderField<AtomicBool>(m_readerEnabledBase, m_readerEnabledStride, id);
 }
 
 template <typename T>
 void SharedDataStream<T>::BufferLayout::enableReaderLocked(size_t id) {
-    m_readerEnabledArray[id] = true;
+    *getReaderField<AtomicBool>(m_readerEnabledBase, m_readerEnabledStride, id) = true;
 }
 
 template <typename T>
 void SharedDataStream<T>::BufferLayout::disableReaderLocked(size_t id) {
-    m_readerEnabledArray[id] = false;
+    *getReaderField<AtomicBool>(m_readerEnabledBase, m_readerEnabledStride, id) = false;
 }
 
 template <typename T>
 typename SharedDataStream<T>::Index SharedDataStream<T>::BufferLayout::wordsUntilWrap(Index after) const {
-    return alignSizeTo(after, getDataSize()) - after;
+    return getDataSize() - (after % getDataSize());
 }
 
 template <typename T>
-size_t SharedDataStream<T>::BufferLayout::calculateDataOffset(size_t wordSize, size_t maxReaders) {
-    return alignSizeTo(calculateReaderCloseIndexArrayOffset(maxReaders) + (maxReaders * sizeof(AtomicIndex)), wordSize);
+size_t SharedDataStream<T>::BufferLayout::calculateDataOffset(
+    size_t wordSize,
+    size_t maxReaders,
+    Layout layout,
+    size_t timestampSlotCount) {
+    size_t timestampOffset =
+        alignSizeTo(calculateReaderStateLayout(maxReaders, layout).endOffset, alignof(TimestampSlot));
+    return alignSizeTo(timestampOffset + timestampSlotCount * sizeof(TimestampSlot), wordSize);
+}
+
+template <typename T>
+size_t SharedDataStream<T>::BufferLayout::calculateTimestampSlotCount(
+    size_t bufferSize,
+    size_t wordSize,
+    size_t maxReaders,
+    Layout layout,
+    size_t timestampBlockWords) {
+    size_t baseOffset = calculateDataOffset(wordSize, maxReaders, layout, 0);
+    if (0 == timestampBlockWords || bufferSize <= baseOffset) {
+        return 0;
+    }
+
+    // Returns the number of data words left over when the ring has the specified number of slots.
+    auto dataWords = [=](size_t slotCount) -> size_t {
+        size_t dataOffset = calculateDataOffset(wordSize, maxReaders, layout, slotCount);
+        return (dataOffset < bufferSize) ? (bufferSize - dataOffset) / wordSize : 0;
+    };
+
+    // Each slot costs roughly sizeof(TimestampSlot) bytes and covers timestampBlockWords words, so start from that
+    // estimate, then adjust for rounding.
+    size_t slotCount = (bufferSize - baseOffset) / (timestampBlockWords * wordSize + sizeof(TimestampSlot));
+    while (slotCount * timestampBlockWords < dataWords(slotCount)) {
+        ++slotCount;
+    }
+    while (slotCount > 0 && (slotCount - 1) * timestampBlockWords >= dataWords(slotCount - 1)) {
+        --slotCount;
+    }
+    return slotCount;
 }
 
 template <typename T>
@@ -642,8 +981,8 @@ void SharedDataStream<T>::BufferLayout::updateOldestUnconsumedCursorLocked() {
         // - if a reader becomes re-enabled, its cursor defaults to writeCursor (which will never be the oldest)
         // - if a reader is created that wants to be at an older index, it gets there by doing a backward seek (which
         //   is locked when this function is called)
-        if (isReaderEnabled(id) && getReaderCursorArray()[id] < oldest) {
-            oldest = getReaderCursorArray()[id];
+        if (isReaderEnabled(id) && *getReaderCursor(id) < oldest) {
+            oldest = *getReaderCursor(id);
         }
     }
 
@@ -667,6 +1006,31 @@ void SharedDataStream<T>::BufferLayout::updateOldestUnconsumedCursorLocked() {
     }
 }
 
+template <typename T>
+void SharedDataStream<T>::BufferLayout::notifyReaders() {
+    auto header = getHeader();
+    Index writeStartCursor = header->writeStartCursor;
+    std::unique_lock<Mutex> dataAvailableLock(header->dataAvailableMutex, std::defer_lock);
+    for (size_t id = 0; id < header->maxReaders; ++id) {
+        if (*getReaderWakeupIndex(id) <= writeStartCursor) {
+            // Lock (once) to make sure the Reader is either waiting or has not yet checked its predicate.
+            if (!dataAvailableLock) {
+                dataAvailableLock.lock();
+            }
+            getReaderConditionVariable(id)->notify_all();
+        }
+    }
+}
+
+template <typename T>
+void SharedDataStream<T>::BufferLayout::notifyAllReaders() {
+    auto header = getHeader();
+    std::lock_guard<Mutex> dataAvailableLock(header->dataAvailableMutex);
+    for (size_t id = 0; id < header->maxReaders; ++id) {
+        getReaderConditionVariable(id)->notify_all();
+    }
+}
+
 template <typename T>
 uint32_t SharedDataStream<T>::BufferLayout::stableHash(const char* string) {
     // Simple, stable hash which XORs all bytes of string into the hash value.
@@ -690,28 +1054,86 @@ size_t SharedDataStream<T>::BufferLayout::alignSizeTo(size_t size, size_t align)
 }
 
 template <typename T>
-size_t SharedDataStream<T>::BufferLayout::calculateReaderEnabledArrayOffset() {
-    return alignSizeTo(sizeof(Header), alignof(AtomicBool));
+typename SharedDataStream<T>::BufferLayout::ReaderStateLayout SharedDataStream<T>::BufferLayout::
+    calculateReaderStateLayout(size_t maxReaders, Layout layout) {
+    ReaderStateLayout readerStateLayout;
+    if (Layout::PADDED == layout) {
+        // Each field is placed at its natural alignment within a slot, and each slot is followed by at least a cache
+        // line's worth of padding (minus one byte), so that no two slots can share a cache line, regardless of the
+        // alignment of the buffer.  The first slot is likewise separated from the Header.
+        size_t enabled = 0;
+        size_t cursor = alignSizeTo(enabled + sizeof(AtomicBool), alignof(AtomicIndex));
+        size_t closeIndex = cursor + sizeof(AtomicIndex);
+        size_t wakeupIndex = closeIndex + sizeof(AtomicIndex);
+        size_t conditionVariable = alignSizeTo(wakeupIndex + sizeof(AtomicIndex), alignof(ConditionVariable));
+        size_t slotSize = conditionVariable + sizeof(ConditionVariable);
+        size_t slotsOffset = alignSizeTo(sizeof(Header) + CACHE_LINE_SIZE - 1, CACHE_LINE_SIZE);
+
+        readerStateLayout.slotStride = alignSizeTo(slotSize + CACHE_LINE_SIZE - 1, CACHE_LINE_SIZE);
+        readerStateLayout.enabledOffset = slotsOffset + enabled;
+        readerStateLayout.cursorOffset = slotsOffset + cursor;
+        readerStateLayout.closeIndexOffset = slotsOffset + closeIndex;
+        readerStateLayout.wakeupIndexOffset = slotsOffset + wakeupIndex;
+        readerStateLayout.conditionVariableOffset = slotsOffset + conditionVariable;
+        readerStateLayout.endOffset = slotsOffset + maxReaders * readerStateLayout.slotStride;
+    } else {
+        // Each field is stored in its own array, aligned to the natural alignment of the field.
+        readerStateLayout.slotStride = 0;
+        readerStateLayout.enabledOffset = alignSizeTo(sizeof(Header), alignof(AtomicBool));
+        readerStateLayout.cursorOffset =
+            alignSizeTo(readerStateLayout.enabledOffset + (maxReaders * sizeof(AtomicBool)), alignof(AtomicIndex));
+        readerStateLayout.closeIndexOffset = readerStateLayout.cursorOffset + (maxReaders * sizeof(AtomicIndex));
+        readerStateLayout.wakeupIndexOffset = readerStateLayout.closeIndexOffset + (maxReaders * sizeof(AtomicIndex));
+        readerStateLayout.conditionVariableOffset = alignSizeTo(
+            readerStateLayout.wakeupIndexOffset + (maxReaders * sizeof(AtomicIndex)), alignof(ConditionVariable));
+        readerStateLayout.endOffset =
+            readerStateLayout.conditionVariableOffset + (maxReaders * sizeof(ConditionVariable));
+    }
+    return readerStateLayout;
 }
 
 template <typename T>
-size_t SharedDataStream<T>::BufferLayout::calculateReaderCursorArrayOffset(size_t maxReaders) {
-    return alignSizeTo(calculateReaderEnabledArrayOffset() + (maxReaders * sizeof(AtomicBool)), alignof(AtomicIndex));
+bool SharedDataStream<T>::BufferLayout::versionToLayout(uint32_t version, Layout* layout) {
+    if (VERSION == version) {
+        *layout = Layout::PACKED;
+        return true;
+    } else if (PADDED_VERSION == version) {
+        *layout = Layout::PADDED;
+        return true;
+    }
+    return false;
 }
 
 template <typename T>
-size_t SharedDataStream<T>::BufferLayout::calculateReaderCloseIndexArrayOffset(size_t maxReaders) {
-    return calculateReaderCursorArrayOffset(maxReaders) + (maxReaders * sizeof(AtomicIndex));
+template <typename FieldType>
+FieldType* SharedDataStream<T>::BufferLayout::getReaderField(uint8_t* base, size_t stride, size_t id) {
+    return reinterpret_cast<FieldType*>(base + id * stride);
 }
 
 template <typename T>
-void SharedDataStream<T>::BufferLayout::calculateAndCacheConstants(size_t wordSize, size_t maxReaders) {
+void SharedDataStream<T>::BufferLayout::calculateAndCacheConstants(
+    size_t wordSize,
+    size_t maxReaders,
+    Layout layout,
+    size_t timestampSlotCount) {
     auto buffer = reinterpret_cast<uint8_t*>(m_buffer->data());
-    m_readerEnabledArray = reinterpret_cast<AtomicBool*>(buffer + calculateReaderEnabledArrayOffset());
-    m_readerCursorArray = reinterpret_cast<AtomicIndex*>(buffer + calculateReaderCursorArrayOffset(maxReaders));
-    m_readerCloseIndexArray = reinterpret_cast<AtomicIndex*>(buffer + calculateReaderCloseIndexArrayOffset(maxReaders));
-    m_dataSize = (m_buffer->size() - calculateDataOffset(wordSize, maxReaders)) / wordSize;
-    m_data = buffer + calculateDataOffset(wordSize, maxReaders);
+    auto readerStateLayout = calculateReaderStateLayout(maxReaders, layout);
+    auto slotStride = readerStateLayout.slotStride;
+    m_readerEnabledBase = buffer + readerStateLayout.enabledOffset;
+    m_readerEnabledStride = slotStride ? slotStride : sizeof(AtomicBool);
+    m_readerCursorBase = buffer + readerStateLayout.cursorOffset;
+    m_readerCursorStride = slotStride ? slotStride : sizeof(AtomicIndex);
+    m_readerCloseIndexBase = buffer + readerStateLayout.closeIndexOffset;
+    m_readerCloseIndexStride = slotStride ? slotStride : sizeof(AtomicIndex);
+    m_readerWakeupIndexBase = buffer + readerStateLayout.wakeupIndexOffset;
+    m_readerWakeupIndexStride = slotStride ? slotStride : sizeof(AtomicIndex);
+    m_readerConditionVariableBase = buffer + readerStateLayout.conditionVariableOffset;
+    m_readerConditionVariableStride = slotStride ? slotStride : sizeof(ConditionVariable);
+    m_timestampSlots = reinterpret_cast<TimestampSlot*>(
+        buffer + alignSizeTo(readerStateLayout.endOffset, alignof(TimestampSlot)));
+    size_t dataOffset = calculateDataOffset(wordSize, maxReaders, layout, timestampSlotCount);
+    m_dataSize = (m_buffer->size() - dataOffset) / wordSize;
+    m_data = buffer + dataOffset;
 }
 
 template <typename T>
@@ -114,6 +114,68 @@ public:
      */
     ssize_t read(void* buf, size_t nWords, std::chrono::milliseconds timeout = std::chrono::milliseconds(0));
 
+    /// This structure describes a contiguous region of the stream's circular data which can be accessed in place.
+    struct Span {
+        /// A pointer to the first word of the region.
+        const void* data;
+
+        /// The number of @c wordSize words in the region.
+        size_t nWords;
+    };
+
+    /**
+     * This function provides direct access to data in the stream without copying it.  Since the data may wrap around
+     * the end of the circular buffer, it is returned as up to two contiguous @c Spans; @c first always holds the
+     * oldest data, and @c second holds the data that follows it (after the wrap) or is empty.  The data is not
+     * consumed until @c commitRead() is called.  Each call to @c beginRead() must be followed by a call to
+     * @c commitRead() before calling @c beginRead(), @c read() or @c seek() again.
+     *
+     * @param nWords The maximum number of @c wordSize words to access.
+     * @param[out] first The @c Span which will describe the first (oldest) region of data.
+     * @param[out] second The @c Span which will describe the region following @c first, if the data wraps.
+     * @param timeout The maximum time to wait (if @c policy is @c BLOCKING) for data.  If this parameter is zero,
+     *     there is no timeout and blocking reads will wait forever.  If @c policy is @c NONBLOCKING, this parameter
+     *     is ignored.
+     * @return The total number of @c wordSize words described by @c first and @c second, or zero if the stream has
+     *     closed, or a negative @c Error code if the stream is still open, but no data is available.  Errors and
+     *     closure are reported exactly as @c read() would report them.
+     *
+     * @note The returned data stays in the buffer until @c commitRead() is called, so @c Writers which do not
+     *     overwrite unconsumed data will leave it untouched.  A @c NONBLOCKABLE @c Writer may still overwrite it, in
+     *     which case @c commitRead() will report @c Error::OVERRUN and the data should be discarded.
+     */
+    ssize_t beginRead(
+        size_t nWords,
+        Span* first,
+        Span* second,
+        std::chrono::milliseconds timeout = std::chrono::milliseconds(0));
+
+    /**
+     * This function consumes data previously returned by @c beginRead(), advancing the @c Reader past it.
+     *
+     * @param nWords The number of @c wordSize words to consume.  This must not be larger than the value returned by
+     *     the preceding @c beginRead() call.  Consuming fewer words leaves the remainder to be returned by the next
+     *     @c beginRead() or @c read() call.
+     * @return @c nWords if the data was consumed, @c Error::OVERRUN if the data was overwritten by the @c Writer while
+     *     it was being accessed, or @c Error::INVALID if @c nWords exceeds the data returned by @c beginRead().
+     */
+    ssize_t commitRead(size_t nWords);
+
+    /**
+     * This function sets the number of words which must be available before a @c BLOCKING @c Reader which is waiting
+     * for data is woken up.  By default a @c BLOCKING @c Reader wakes up as soon as a single word is available; a
+     * @c Reader which processes data in fixed-size frames can use a larger threshold to avoid being woken up by every
+     * small @c write().  The threshold has no effect on @c NONBLOCKING @c Readers.
+     *
+     * @note A @c BLOCKING @c read() or @c beginRead() will still return fewer words than the threshold if the
+     *     @c Writer closes, if the @c Reader's close index is reached first, or if the timeout expires while some
+     *     (but not enough) data is available.
+     *
+     * @param nWords The minimum number of @c wordSize words to wait for.  This value is limited to the size of the
+     *     stream; a value of zero is treated as one.
+     */
+    void setWakeupThreshold(size_t nWords);
+
     /**
      * This function moves the @c Reader to the specified location in the stream.  If successful, subsequent calls to
      * @c read() will start from the new location.  For this function to succeed, the specified location *must* point
@@ -140,6 +202,18 @@ public:
      */
     Index tell(Reference reference = Reference::ABSOLUTE) const;
 
+    /**
+     * This function looks up the capture time of a position in the stream, if the stream records capture timestamps
+     * (see @c SharedDataStream::create()) and the @c Writer supplied one when writing that position.
+     *
+     * @param index The absolute @c Index (as returned by `tell(Reference::ABSOLUTE)`) to look up.
+     * @param[out] timestamp The capture time of the start of the write which contained the first word of the
+     *     timestamp block containing @c index.
+     * @return @c true if a timestamp is available, or @c false if the stream does not record capture timestamps, the
+     *     @c Writer did not supply one, or @c index is not currently in the stream.
+     */
+    bool getTimestamp(Index index, Timestamp* timestamp) const;
+
     /**
      * This function sets the point at which the @c Reader's stream will close.  With the default parameters, this
      * function will close t he stream immediately, without reading any additional data.  To schedule the stream to
@@ -194,16 +268,27 @@ private:
     std::shared_ptr<BufferLayout> m_bufferLayout;
 
     /**
-     * The index in @c BufferLayout::getReaderCursorArray() and @c BufferLayout::getReaderCloseIndexArray() assigned to
-     * this @c Reader.
+     * The id used to locate this @c Reader's state in the @c BufferLayout.
      */
     uint8_t m_id;
 
-    /// Pointer to this reader's cursor in BufferLayout::getReaderCursorArray().
+    /// Pointer to this reader's cursor (see BufferLayout::getReaderCursor()).
     AtomicIndex* m_readerCursor;
 
-    /// Pointer to this reader's close index in BufferLayout::getReaderCloseIndexArray().
+    /// Pointer to this reader's close index (see BufferLayout::getReaderCloseIndex()).
     AtomicIndex* m_readerCloseIndex;
+
+    /// Pointer to this reader's wakeup index (see BufferLayout::getReaderWakeupIndex()).
+    AtomicIndex* m_readerWakeupIndex;
+
+    /// Pointer to this reader's condition variable (see BufferLayout::getReaderConditionVariable()).
+    ConditionVariable* m_readerConditionVariable;
+
+    /// The number of words which must be available before a blocked @c read() is woken up.
+    size_t m_wakeupThreshold;
+
+    /// The number of words returned by the last @c beginRead() call which have not yet been passed to @c commitRead().
+    size_t m_pendingReadWords;
 };
 
 template <typename T>
@@ -214,8 +299,12 @@ SharedDataStream<T>::Reader::Reader(Policy policy, std::shared_ptr<BufferLayout>
         m_policy{policy},
         m_bufferLayout{bufferLayout},
         m_id{id},
-        m_readerCursor{&m_bufferLayout->getReaderCursorArray()[m_id]},
-        m_readerCloseIndex{&m_bufferLayout->getReaderCloseIndexArray()[m_id]} {
+        m_readerCursor{m_bufferLayout->getReaderCursor(m_id)},
+        m_readerCloseIndex{m_bufferLayout->getReaderCloseIndex(m_id)},
+        m_readerWakeupIndex{m_bufferLayout->getReaderWakeupIndex(m_id)},
+        m_readerConditionVariable{m_bufferLayout->getReaderConditionVariable(m_id)},
+        m_wakeupThreshold{1},
+        m_pendingReadWords{0} {
     // Note - SharedDataStream::createReader() holds readerEnableMutex while calling this function.
     // Read new data only.
     // Note: It is important that new readers start with their cursor at the writer.  This allows
@@ -226,6 +315,9 @@ SharedDataStream<T>::Reader::Reader(Policy policy, std::shared_ptr<BufferLayout>
     // Read indefinitely.
     *m_readerCloseIndex = std::numeric_limits<Index>::max();
 
+    // Not waiting for data.
+    *m_readerWakeupIndex = std::numeric_limits<Index>::max();
+
     m_bufferLayout->enableReaderLocked(m_id);
 }
 
@@ -252,6 +344,42 @@ ssize_t SharedDataStream<T>::Reader::read(void* buf, size_t nWords, std::chrono:
         return Error::INVALID;
     }
 
+    Span first;
+    Span second;
+    auto wordsAvailable = beginRead(nWords, &first, &second, timeout);
+    if (wordsAvailable <= 0) {
+        return wordsAvailable;
+    }
+
+    // Copy the two segments.
+    auto buf8 = static_cast<uint8_t*>(buf);
+    memcpy(buf8, first.data, first.nWords * getWordSize());
+    if (second.nWords > 0) {
+        memcpy(buf8 + (first.nWords * getWordSize()), second.data, second.nWords * getWordSize());
+    }
+
+    return commitRead(wordsAvailable);
+}
+
+template <typename T>
+ssize_t SharedDataStream<T>::Reader::beginRead(
+    size_t nWords,
+    Span* first,
+    Span* second,
+    std::chrono::milliseconds timeout) {
+    if (nullptr == first || nullptr == second) {
+        logger::acsdkError(logger::LogEntry(TAG, "beginReadFailed").d("reason", "nullSpan"));
+        return Error::INVALID;
+    }
+
+    if (0 == nWords) {
+        logger::acsdkError(
+            logger::LogEntry(TAG, "beginReadFailed").d("reason", "invalidNumWords").d("numWords", nWords));
+        return Error::INVALID;
+    }
+
+    m_pendingReadWords = 0;
+
     // Check if closed.
     auto readerCloseIndex = m_readerCloseIndex->load();
     if (*m_readerCursor >= readerCloseIndex) {
@@ -265,41 +393,44 @@ ssize_t SharedDataStream<T>::Reader::read(void* buf, size_t nWords, std::chrono:
         return Error::OVERRUN;
     }
 
-    std::unique_lock<Mutex> lock(header->dataAvailableMutex, std::defer_lock);
-    if (Policy::BLOCKING == m_policy) {
-        lock.lock();
-    }
-
-    // Figure out how much we can actually copy.
+    // Figure out how much we can actually access.
     size_t wordsAvailable = tell(Reference::BEFORE_WRITER);
-    if (0 == wordsAvailable) {
-        if (header->writeEndCursor > 0 && !header->isWriterEnabled) {
-            return Error::CLOSED;
-        } else if (Policy::NONBLOCKING == m_policy) {
-            return Error::WOULDBLOCK;
-        } else if (Policy::BLOCKING == m_policy) {
-            // Condition for returning from read: the Writer has been closed or there is data to read
-            auto predicate = [this, header] {
-                return header->hasWriterBeenClosed || tell(Reference::BEFORE_WRITER) > 0;
-            };
-
-            if (std::chrono::milliseconds::zero() == timeout) {
-                header->dataAvailableConditionVariable.wait(lock, predicate);
-            } else if (!header->dataAvailableConditionVariable.wait_for(lock, timeout, predicate)) {
-                return Error::TIMEDOUT;
-            }
+    if (0 == wordsAvailable && header->writeEndCursor > 0 && !header->isWriterEnabled) {
+        return Error::CLOSED;
+    } else if (0 == wordsAvailable && Policy::NONBLOCKING == m_policy) {
+        return Error::WOULDBLOCK;
+    } else if (wordsAvailable < m_wakeupThreshold && Policy::BLOCKING == m_policy) {
+        // Wait for the threshold to be reached, but not beyond our close index.
+        Index wakeupIndex = *m_readerCursor + m_wakeupThreshold;
+        if (wakeupIndex > readerCloseIndex) {
+            wakeupIndex = readerCloseIndex;
         }
-        wordsAvailable = tell(Reference::BEFORE_WRITER);
 
-        // If there is still no data, the writer has closed in the interim
+        // Condition for returning from read: the Writer has been closed or there is enough data to read.
+        auto predicate = [header, wakeupIndex] {
+            return header->hasWriterBeenClosed || header->writeStartCursor >= wakeupIndex;
+        };
+
+        // Note: The wakeup index must be published before the predicate is first checked; see
+        // BufferLayout::notifyReaders() for details.
+        std::unique_lock<Mutex> lock(header->dataAvailableMutex);
+        *m_readerWakeupIndex = wakeupIndex;
+        bool timedOut = false;
+        if (std::chrono::milliseconds::zero() == timeout) {
+            m_readerConditionVariable->wait(lock, predicate);
+        } else {
+            timedOut = !m_readerConditionVariable->wait_for(lock, timeout, predicate);
+        }
+        *m_readerWakeupIndex = std::numeric_limits<Index>::max();
+        lock.unlock();
+
+        wordsAvailable = tell(Reference::BEFORE_WRITER);
         if (0 == wordsAvailable) {
-            return Error::CLOSED;
+            // If there is still no data, either we timed out or the writer has closed in the interim.
+            return timedOut ? Error::TIMEDOUT : Error::CLOSED;
         }
     }
 
-    if (Policy::BLOCKING == m_policy) {
-        lock.unlock();
-    }
     if (nWords > wordsAvailable) {
         nWords = wordsAvailable;
     }
@@ -316,20 +447,31 @@ ssize_t SharedDataStream<T>::Reader::read(void* buf, size_t nWords, std::chrono:
     }
     size_t afterWrap = nWords - beforeWrap;
 
-    // Copy the two segments.
-    auto buf8 = static_cast<uint8_t*>(buf);
-    memcpy(buf8, m_bufferLayout->getData(*m_readerCursor), beforeWrap * getWordSize());
-    if (afterWrap > 0) {
-        memcpy(
-            buf8 + (beforeWrap * getWordSize()),
-            m_bufferLayout->getData(*m_readerCursor + beforeWrap),
-            afterWrap * getWordSize());
+    first->data = m_bufferLayout->getData(*m_readerCursor);
+    first->nWords = beforeWrap;
+    second->data = afterWrap > 0 ? m_bufferLayout->getData(*m_readerCursor + beforeWrap) : nullptr;
+    second->nWords = afterWrap;
+
+    m_pendingReadWords = nWords;
+    return nWords;
+}
+
+template <typename T>
+ssize_t SharedDataStream<T>::Reader::commitRead(size_t nWords) {
+    if (nWords > m_pendingReadWords) {
+        logger::acsdkError(logger::LogEntry(TAG, "commitReadFailed")
+                               .d("reason", "invalidNumWords")
+                               .d("numWords", nWords)
+                               .d("pendingWords", m_pendingReadWords));
+        return Error::INVALID;
     }
+    m_pendingReadWords = 0;
 
     // Advance the read cursor.
     *m_readerCursor += nWords;
 
     // Final check for overrun (do this before the updateOldestUnconsumedCursor() call below for improved accuracy).
+    auto header = m_bufferLayout->getHeader();
     bool overrun = ((header->writeEndCursor - *m_readerCursor) > m_bufferLayout->getDataSize());
 
     // Move the unconsumed cursor before returning.
@@ -343,6 +485,16 @@ ssize_t SharedDataStream<T>::Reader::read(void* buf, size_t nWords, std::chrono:
     return nWords;
 }
 
+template <typename T>
+void SharedDataStream<T>::Reader::setWakeupThreshold(size_t nWords) {
+    if (0 == nWords) {
+        nWords = 1;
+    } else if (nWords > m_bufferLayout->getDataSize()) {
+        nWords = m_bufferLayout->getDataSize();
+    }
+    m_wakeupThreshold = nWords;
+}
+
 template <typename T>
 bool SharedDataStream<T>::Reader::seek(Index offset, Reference reference) {
     auto header = m_bufferLayout->getHeader();
@@ -435,6 +587,11 @@ typename SharedDataStream<T>::Index SharedDataStream<T>::Reader::tell(Reference
     return std::numeric_limits<Index>::max();
 }
 
+template <typename T>
+bool SharedDataStream<T>::Reader::getTimestamp(Index index, Timestamp* timestamp) const {
+    return m_bufferLayout->getTimestamp(index, timestamp);
+}
+
 template <typename T>
 void SharedDataStream<T>::Reader::close(Index offset, Reference reference) {
     auto writeStartCursor = &m_bufferLayout->getHeader()->writeStartCursor;
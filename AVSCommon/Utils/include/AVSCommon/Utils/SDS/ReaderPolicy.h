@@ -31,9 +31,10 @@ enum class ReaderPolicy {
     NONBLOCKING,
     /**
      * A @c BLOCKING @c Reader will wait for up to the specified timeout (or forever if `(timeout == 0)`) for data
-     * to become available.  As soon as at least one word is available, the @c Reader will return up to the
-     * requested amount of data.  If no data becomes available in the specified timeout, a @c BLOCKING @c Reader
-     * will return @c Error::TIMEDOUT.
+     * to become available.  As soon as at least one word (or the number of words set with
+     * @c Reader::setWakeupThreshold()) is available, the @c Reader will return up to the requested amount of data.
+     * If no data becomes available in the specified timeout, a @c BLOCKING @c Reader will return
+     * @c Error::TIMEDOUT.
      */
     BLOCKING
 };
@@ -16,6 +16,7 @@
 #ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_SDS_SHAREDDATASTREAM_H_
 #define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_SDS_SHAREDDATASTREAM_H_
 
+#include <chrono>
 #include <cstdint>
 #include <cstddef>
 #include <memory>
@@ -119,6 +120,31 @@ public:
     /// A condition variable type which works with @c Mutex.
     using ConditionVariable = typename T::ConditionVariable;
 
+    /// Specifies how the per-@c Reader state is laid out in the @c Buffer.
+    enum class Layout {
+        /// The per-@c Reader state is packed into arrays, which minimizes the size of the @c Buffer.
+        PACKED,
+        /**
+         * The per-@c Reader state is padded so that each @c Reader's state occupies its own cache line(s).  This
+         * avoids false sharing between @c Readers running on different cores, at the cost of a larger @c Buffer.
+         */
+        PADDED
+    };
+
+    /**
+     * The capture time of a position in the stream, as recorded by @c Writer::write() or @c Writer::commitWrite().
+     * This identifies the start of the write which contained the position, so if the rate at which words are
+     * captured is known, the capture time of the position itself is
+     * `captureTime + (position - index) * wordDuration`.
+     */
+    struct Timestamp {
+        /// The @c Index of the first word of the write which was tagged with @c captureTime.
+        Index index;
+
+        /// The capture time of the word at @c index.
+        std::chrono::steady_clock::time_point captureTime;
+    };
+
     // Forward declare the nested @c Reader class (full declaration is in @c Reader.h).
     class Reader;
 
@@ -134,10 +160,19 @@ public:
      *     data or position in the stream are quantified in words.  The stream's data storage capacity in bytes is
      *     `nWords * wordSize`.  This parameter defaults to 1.
      * @param maxReaders The maximum number of readers the stream will support.  This parameter defaults to 1.
+     * @param layout The @c Layout which will be used for the per-@c Reader state.  This parameter defaults to
+     *     @c Layout::PACKED.
+     * @param timestampBlockWords The number of words which will be covered by each capture timestamp (see
+     *     @c create()).  This parameter defaults to zero, which means no capture timestamps will be recorded.
      * @return The buffer size (in bytes) required to support the specified parameters, or zero if parameters are
      *     invalid.
      */
-    static size_t calculateBufferSize(size_t nWords, size_t wordSize = 1, size_t maxReaders = 1);
+    static size_t calculateBufferSize(
+        size_t nWords,
+        size_t wordSize = 1,
+        size_t maxReaders = 1,
+        Layout layout = Layout::PACKED,
+        size_t timestampBlockWords = 0);
 
     /**
      * This function creates a new @c SharedDataStream.  It will first verify that the @c Buffer is large enough to
@@ -151,12 +186,21 @@ public:
      * @param wordSize The size (in bytes) of words in the stream.  All @c SharedDataStream operations that work with
      *     data or position in the stream are quantified in words.  This parameter defaults to 1.
      * @param maxReaders The maximum number of readers the stream will support.  This parameter defaults to 1.
+     * @param layout The @c Layout to use for the per-@c Reader state.  This parameter defaults to @c Layout::PACKED.
+     *     Streams which are opened with @c open() automatically use the @c Layout the @c buffer was created with.
+     * @param timestampBlockWords If non-zero, the stream keeps a ring of capture timestamps alongside the data, with
+     *     one timestamp for every @c timestampBlockWords words, which can be looked up with
+     *     @c Reader::getTimestamp().  Setting this to the number of words in a typical @c Writer::write() (for
+     *     example, one 10ms audio frame) gives an exact timestamp for every write.  This parameter defaults to zero,
+     *     which means no capture timestamps will be recorded.
      * @return The new stream if @c buffer was successfully initialized, else @c nullptr.
      */
     static std::unique_ptr<SharedDataStream> create(
         std::shared_ptr<Buffer> buffer,
         size_t wordSize = 1,
-        size_t maxReaders = 1);
+        size_t maxReaders = 1,
+        Layout layout = Layout::PACKED,
+        size_t timestampBlockWords = 0);
 
     /**
      * This function creates a new @c SharedDataStream using a preinitialized @c Buffer.  This allows a stream to
@@ -194,6 +238,15 @@ public:
      */
     size_t getWordSize() const;
 
+    /**
+     * This function returns the number of words covered by each capture timestamp.  This function can be safely
+     * called from multiple threads or processes.
+     *
+     * @return The number of words covered by each capture timestamp, or zero if this stream does not record capture
+     *     timestamps.
+     */
+    size_t getTimestampBlockWords() const;
+
     /**
      * This function creates a @c Writer to the stream.  Only one @c Writer is allowed at a time.  This function must
      * not be called from multiple threads or processes.
@@ -307,7 +360,12 @@ template <typename T>
 const std::string SharedDataStream<T>::TAG = "SharedDataStream";
 
 template <typename T>
-size_t SharedDataStream<T>::calculateBufferSize(size_t nWords, size_t wordSize, size_t maxReaders) {
+size_t SharedDataStream<T>::calculateBufferSize(
+    size_t nWords,
+    size_t wordSize,
+    size_t maxReaders,
+    Layout layout,
+    size_t timestampBlockWords) {
     if (0 == nWords) {
         logger::acsdkError(logger::LogEntry(TAG, "calculateBufferSizeFailed").d("reason", "numWordsZero"));
         return 0;
@@ -315,7 +373,8 @@ size_t SharedDataStream<T>::calculateBufferSize(size_t nWords, size_t wordSize,
         logger::acsdkError(logger::LogEntry(TAG, "calculateBufferSizeFailed").d("reason", "wordSizeZero"));
         return 0;
     }
-    size_t overhead = BufferLayout::calculateDataOffset(wordSize, maxReaders);
+    size_t timestampSlotCount = timestampBlockWords ? ((nWords - 1) / timestampBlockWords) + 1 : 0;
+    size_t overhead = BufferLayout::calculateDataOffset(wordSize, maxReaders, layout, timestampSlotCount);
     size_t dataSize = nWords * wordSize;
     return overhead + dataSize;
 }
@@ -324,8 +383,10 @@ template <typename T>
 std::unique_ptr<SharedDataStream<T>> SharedDataStream<T>::create(
     std::shared_ptr<Buffer> buffer,
     size_t wordSize,
-    size_t maxReaders) {
-    size_t expectedSize = calculateBufferSize(1, wordSize, maxReaders);
+    size_t maxReaders,
+    Layout layout,
+    size_t timestampBlockWords) {
+    size_t expectedSize = calculateBufferSize(1, wordSize, maxReaders, layout, timestampBlockWords);
     if (0 == expectedSize) {
         // Logged in calcutlateBuffersize().
         return nullptr;
@@ -341,7 +402,7 @@ std::unique_ptr<SharedDataStream<T>> SharedDataStream<T>::create(
     }
 
     std::unique_ptr<SharedDataStream<T>> sds(new SharedDataStream<T>(buffer));
-    if (!sds->m_bufferLayout->init(wordSize, maxReaders)) {
+    if (!sds->m_bufferLayout->init(wordSize, maxReaders, layout, timestampBlockWords)) {
         // Logged in init().
         return nullptr;
     }
@@ -374,6 +435,11 @@ size_t SharedDataStream<T>::getWordSize() const {
     return m_bufferLayout->getHeader()->wordSize;
 }
 
+template <typename T>
+size_t SharedDataStream<T>::getTimestampBlockWords() const {
+    return m_bufferLayout->getTimestampBlockWords();
+}
+
 template <typename T>
 std::unique_ptr<typename SharedDataStream<T>::Writer> SharedDataStream<T>::createWriter(
     typename Writer::Policy policy,
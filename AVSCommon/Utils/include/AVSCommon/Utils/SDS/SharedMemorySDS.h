@@ -0,0 +1,306 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_SDS_SHAREDMEMORYSDS_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_SDS_SHAREDMEMORYSDS_H_
+
+#include <pthread.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "SharedDataStream.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace sds {
+
+/**
+ * A mutex which can be placed in shared memory and locked from multiple processes.  The mutex is robust: if a process
+ * dies while holding it, the next process to lock it takes ownership and marks it consistent again, rather than
+ * deadlocking.
+ *
+ * This class satisfies the @c Lockable requirements, so it can be used with @c std::lock_guard and
+ * @c std::unique_lock.
+ */
+class ProcessSharedMutex {
+public:
+    /// Initializes a process-shared, robust mutex in place.
+    ProcessSharedMutex();
+
+    /// Destroys the mutex.
+    ~ProcessSharedMutex();
+
+    /// Waits indefinitely for the mutex to unlock and then locks the mutex.
+    void lock();
+
+    /**
+     * Attempts to lock the mutex without blocking.
+     *
+     * @return @c true if the mutex was locked, else @c false.
+     */
+    bool try_lock();
+
+    /// Unlocks the mutex.
+    void unlock();
+
+    /**
+     * Provides access to the underlying pthread mutex.
+     *
+     * @return A pointer to the underlying pthread mutex.
+     */
+    pthread_mutex_t* native_handle();
+
+    /// This class is placed directly in shared memory, so it may not be copied.
+    ProcessSharedMutex(const ProcessSharedMutex&) = delete;
+    ProcessSharedMutex& operator=(const ProcessSharedMutex&) = delete;
+
+private:
+    /// The underlying pthread mutex.
+    pthread_mutex_t m_mutex;
+};
+
+/**
+ * A condition variable which can be placed in shared memory and used with a @c ProcessSharedMutex from multiple
+ * processes.  Timed waits are measured against @c CLOCK_MONOTONIC, so they are not affected by wall clock changes.
+ */
+class ProcessSharedConditionVariable {
+public:
+    /// Initializes a process-shared condition variable in place.
+    ProcessSharedConditionVariable();
+
+    /// Destroys the condition variable.
+    ~ProcessSharedConditionVariable();
+
+    /// Unblocks one of the threads waiting for this condition variable.
+    void notify_one();
+
+    /// Unblocks all of the threads waiting for this condition variable.
+    void notify_all();
+
+    /**
+     * Waits indefinitely for this condition variable to be notified.
+     *
+     * @param lock A lock which the caller must be holding on the @c ProcessSharedMutex associated with this condition
+     *     variable.
+     */
+    void wait(std::unique_lock<ProcessSharedMutex>& lock);
+
+    /**
+     * Waits indefinitely for @c predicate to be satisfied.
+     *
+     * @param lock A lock which the caller must be holding on the @c ProcessSharedMutex associated with this condition
+     *     variable.
+     * @param predicate The condition to wait for.
+     */
+    template <typename Predicate>
+    void wait(std::unique_lock<ProcessSharedMutex>& lock, Predicate predicate);
+
+    /**
+     * Waits up to @c timeout for @c predicate to be satisfied.
+     *
+     * @param lock A lock which the caller must be holding on the @c ProcessSharedMutex associated with this condition
+     *     variable.
+     * @param timeout The maximum time to wait.
+     * @param predicate The condition to wait for.
+     * @return The value of @c predicate when the wait completed.
+     */
+    template <typename Rep, typename Period, typename Predicate>
+    bool wait_for(
+        std::unique_lock<ProcessSharedMutex>& lock,
+        const std::chrono::duration<Rep, Period>& timeout,
+        Predicate predicate);
+
+    /// This class is placed directly in shared memory, so it may not be copied.
+    ProcessSharedConditionVariable(const ProcessSharedConditionVariable&) = delete;
+    ProcessSharedConditionVariable& operator=(const ProcessSharedConditionVariable&) = delete;
+
+private:
+    /**
+     * Waits until @c deadline (measured on @c CLOCK_MONOTONIC) for this condition variable to be notified.
+     *
+     * @param lock A lock which the caller must be holding on the @c ProcessSharedMutex associated with this condition
+     *     variable.
+     * @param deadline The @c CLOCK_MONOTONIC time at which to stop waiting.
+     * @return @c false if @c deadline was reached, else @c true.
+     */
+    bool waitUntil(std::unique_lock<ProcessSharedMutex>& lock, const timespec& deadline);
+
+    /**
+     * Calculates the @c CLOCK_MONOTONIC time which is @c timeout from now.
+     *
+     * @param timeout The time from now to calculate the deadline for.
+     * @return The @c CLOCK_MONOTONIC time which is @c timeout from now.
+     */
+    static timespec deadlineFromNow(std::chrono::nanoseconds timeout);
+
+    /// The underlying pthread condition variable.
+    pthread_cond_t m_conditionVariable;
+};
+
+/**
+ * A @c Buffer backed by a POSIX shared memory object which is mapped into the address space of each process which
+ * uses it.  A @c Buffer created by name with @c create() can be mapped into another process with @c open(), and a
+ * @c SharedDataStream can then be opened on it with @c SharedDataStream::open().
+ *
+ * The process which creates a named @c SharedMemoryBuffer owns the name, and unlinks it when the buffer is destroyed.
+ * Processes which have already mapped the buffer keep their mappings until they destroy their own
+ * @c SharedMemoryBuffer instances.
+ */
+class SharedMemoryBuffer {
+public:
+    /**
+     * Creates a new named shared memory buffer.  Creation fails if a shared memory object with the same name already
+     * exists.
+     *
+     * @param name The name of the shared memory object (see @c shm_open()); this should begin with a '/'.
+     * @param size The size (in bytes) of the buffer.
+     * @return The new buffer, or @c nullptr if the buffer could not be created.
+     */
+    static std::shared_ptr<SharedMemoryBuffer> create(const std::string& name, size_t size);
+
+    /**
+     * Maps a named shared memory buffer which was previously created by @c create(), possibly by another process.
+     *
+     * @param name The name the buffer was created with.
+     * @return The mapped buffer, or @c nullptr if no buffer with this name could be mapped.
+     */
+    static std::shared_ptr<SharedMemoryBuffer> open(const std::string& name);
+
+    /**
+     * Creates an anonymous shared memory buffer.  The buffer is shared with child processes created with @c fork()
+     * after construction, but cannot be opened by name.  This constructor lets a @c SharedMemoryBuffer be constructed
+     * in the same way as other @c Buffer types.  If the buffer cannot be allocated, @c data() will return
+     * @c nullptr and @c size() will return zero.
+     *
+     * @param size The size (in bytes) of the buffer.
+     */
+    explicit SharedMemoryBuffer(size_t size);
+
+    /// Unmaps the buffer, and unlinks its name if this instance created it.
+    ~SharedMemoryBuffer();
+
+    /**
+     * Provides access to the buffer's storage.
+     *
+     * @return A pointer to the start of the buffer.
+     */
+    uint8_t* data();
+
+    /**
+     * Provides access to the buffer's storage.
+     *
+     * @return A pointer to the start of the buffer.
+     */
+    const uint8_t* data() const;
+
+    /**
+     * Returns the size of the buffer.
+     *
+     * @return The size (in bytes) of the buffer.
+     */
+    size_t size() const;
+
+    /**
+     * Returns the name of the buffer.
+     *
+     * @return The name of the shared memory object, or an empty string for an anonymous buffer.
+     */
+    std::string name() const;
+
+    /// This class owns a memory mapping, so it may not be copied.
+    SharedMemoryBuffer(const SharedMemoryBuffer&) = delete;
+    SharedMemoryBuffer& operator=(const SharedMemoryBuffer&) = delete;
+
+private:
+    /**
+     * Constructor.
+     *
+     * @param name The name of the shared memory object.
+     * @param data The start of the mapping.
+     * @param size The size (in bytes) of the mapping.
+     * @param ownsName Whether this instance should unlink @c name when it is destroyed.
+     */
+    SharedMemoryBuffer(const std::string& name, uint8_t* data, size_t size, bool ownsName);
+
+    /// The name of the shared memory object.
+    const std::string m_name;
+
+    /// The start of the mapping.
+    uint8_t* m_data;
+
+    /// The size (in bytes) of the mapping.
+    size_t m_size;
+
+    /// Whether this instance should unlink @c m_name when it is destroyed.
+    const bool m_ownsName;
+};
+
+/// Structure for specifying the traits of a SharedDataStream which works between processes.
+struct SharedMemorySDSTraits {
+    /// Lock-free std::atomic operates directly on memory, so it also works between processes.
+    using AtomicIndex = std::atomic<uint64_t>;
+
+    /// Lock-free std::atomic operates directly on memory, so it also works between processes.
+    using AtomicBool = std::atomic<bool>;
+
+    /// A POSIX shared memory object mapped into each process.
+    using Buffer = SharedMemoryBuffer;
+
+    /// A process-shared pthread mutex.
+    using Mutex = ProcessSharedMutex;
+
+    /// A process-shared pthread condition variable.
+    using ConditionVariable = ProcessSharedConditionVariable;
+
+    /// A unique identifier representing this combination of traits.
+    static constexpr const char* traitsName = "alexaClientSDK::avsCommon::utils::sds::SharedMemorySDSTraits";
+};
+
+/// Type alias for a SharedDataStream which works between processes.
+using SharedMemorySDS = SharedDataStream<SharedMemorySDSTraits>;
+
+template <typename Predicate>
+void ProcessSharedConditionVariable::wait(std::unique_lock<ProcessSharedMutex>& lock, Predicate predicate) {
+    while (!predicate()) {
+        wait(lock);
+    }
+}
+
+template <typename Rep, typename Period, typename Predicate>
+bool ProcessSharedConditionVariable::wait_for(
+    std::unique_lock<ProcessSharedMutex>& lock,
+    const std::chrono::duration<Rep, Period>& timeout,
+    Predicate predicate) {
+    auto deadline = deadlineFromNow(std::chrono::duration_cast<std::chrono::nanoseconds>(timeout));
+    while (!predicate()) {
+        if (!waitUntil(lock, deadline)) {
+            return predicate();
+        }
+    }
+    return true;
+}
+
+}  // namespace sds
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_SDS_SHAREDMEMORYSDS_H_
@@ -96,6 +96,87 @@ public:
      */
     ssize_t write(const void* buf, size_t nWords, std::chrono::milliseconds timeout = std::chrono::milliseconds(0));
 
+    /**
+     * This function adds new data to the stream by copying it from the provided buffer, and tags it with the time at
+     * which it was captured.  This behaves exactly like @c write() without a @c captureTime, except that if the stream
+     * records capture timestamps (see @c SharedDataStream::create()), @c Readers can look up @c captureTime with
+     * @c Reader::getTimestamp().  @c buf may hold several frames of data; they all share the single @c captureTime
+     * of the first word.
+     *
+     * @param buf A buffer to copy the data from.
+     * @param nWords The maximum number of @c wordSize words to copy.
+     * @param captureTime The time at which the first word in @c buf was captured.
+     * @param timeout The maximum time to wait (if @c policy is @c BLOCKING) for space to write into.  If this parameter
+     *     is zero, there is no timeout and blocking writes will wait forever.  If @c policy is not @C BLOCKING, this
+     *     parameter is ignored.
+     * @return The number of @c wordSize words copied, or zero if the stream has closed, or a
+     *     negative @c Error code if the stream is still open, but no data could be written.
+     */
+    ssize_t write(
+        const void* buf,
+        size_t nWords,
+        std::chrono::steady_clock::time_point captureTime,
+        std::chrono::milliseconds timeout = std::chrono::milliseconds(0));
+
+    /// This structure describes a contiguous region of the stream's circular data which can be written in place.
+    struct Span {
+        /// A pointer to the first word of the region.
+        void* data;
+
+        /// The number of @c wordSize words in the region.
+        size_t nWords;
+    };
+
+    /**
+     * This function reserves space in the stream so that data can be produced directly into the buffer without
+     * copying it.  Since the space may wrap around the end of the circular buffer, it is returned as up to two
+     * contiguous @c Spans; @c first must be filled before @c second.  The data is not visible to @c Readers until
+     * @c commitWrite() is called.  Each call to @c beginWrite() must be followed by a call to @c commitWrite() before
+     * calling @c beginWrite(), @c write() or @c close() again.
+     *
+     * @param nWords The maximum number of @c wordSize words to reserve.  Unlike @c write(), this is always limited to
+     *     the size of the stream, for all policies.
+     * @param[out] first The @c Span which will describe the first region of reserved space.
+     * @param[out] second The @c Span which will describe the region following @c first, if the space wraps.
+     * @param timeout The maximum time to wait (if @c policy is @c BLOCKING) for space to write into.  If this parameter
+     *     is zero, there is no timeout and blocking writes will wait forever.  If @c policy is not @C BLOCKING, this
+     *     parameter is ignored.
+     * @return The total number of @c wordSize words described by @c first and @c second, or zero if the stream has
+     *     closed, or a negative @c Error code if the stream is still open, but no space could be reserved.  The
+     *     policy is applied exactly as @c write() would apply it.
+     *
+     * @note @c Readers treat reserved space as being written, so the time between @c beginWrite() and
+     *     @c commitWrite() should be kept short.
+     */
+    ssize_t beginWrite(
+        size_t nWords,
+        Span* first,
+        Span* second,
+        std::chrono::milliseconds timeout = std::chrono::milliseconds(0));
+
+    /**
+     * This function publishes data written into the space returned by @c beginWrite(), making it available to
+     * @c Readers.
+     *
+     * @param nWords The number of @c wordSize words to publish.  This must not be larger than the value returned by
+     *     the preceding @c beginWrite() call.  Any remaining reserved space is released.
+     * @return @c nWords if the data was published, or @c Error::INVALID if @c nWords exceeds the space returned by
+     *     @c beginWrite().
+     */
+    ssize_t commitWrite(size_t nWords);
+
+    /**
+     * This function publishes data written into the space returned by @c beginWrite(), and tags it with the time at
+     * which it was captured (see @c write()).
+     *
+     * @param nWords The number of @c wordSize words to publish.  This must not be larger than the value returned by
+     *     the preceding @c beginWrite() call.  Any remaining reserved space is released.
+     * @param captureTime The time at which the first published word was captured.
+     * @return @c nWords if the data was published, or @c Error::INVALID if @c nWords exceeds the space returned by
+     *     @c beginWrite().
+     */
+    ssize_t commitWrite(size_t nWords, std::chrono::steady_clock::time_point captureTime);
+
     /**
      * This function reports the current position of the @c Writer in the stream.
      *
@@ -130,6 +211,50 @@ private:
      */
     static const std::string TAG;
 
+    /**
+     * This function applies the @c Policy to reserve space for a write, and moves @c Header::writeEndCursor to the
+     * end of the reserved region.
+     *
+     * @param nWords The number of @c wordSize words to reserve.
+     * @param timeout The maximum time to wait (if @c policy is @c BLOCKING) for space to write into.
+     * @return The number of @c wordSize words reserved, or zero if the stream has closed, or a negative @c Error
+     *     code if the stream is still open, but no space could be reserved.
+     */
+    ssize_t reserve(size_t nWords, std::chrono::milliseconds timeout);
+
+    /**
+     * This function implements both variants of @c write().
+     *
+     * @param buf A buffer to copy the data from.
+     * @param nWords The maximum number of @c wordSize words to copy.
+     * @param captureTime The time at which the first word in @c buf was captured, or @c nullptr if it is not known.
+     * @param timeout The maximum time to wait (if @c policy is @c BLOCKING) for space to write into.
+     * @return The number of @c wordSize words copied, or zero if the stream has closed, or a
+     *     negative @c Error code if the stream is still open, but no data could be written.
+     */
+    ssize_t copyIn(
+        const void* buf,
+        size_t nWords,
+        const std::chrono::steady_clock::time_point* captureTime,
+        std::chrono::milliseconds timeout);
+
+    /**
+     * This function implements both variants of @c commitWrite().
+     *
+     * @param nWords The number of @c wordSize words to publish.
+     * @param captureTime The time at which the first published word was captured, or @c nullptr if it is not known.
+     * @return @c nWords if the data was published, or @c Error::INVALID if @c nWords exceeds the space returned by
+     *     @c beginWrite().
+     */
+    ssize_t commit(size_t nWords, const std::chrono::steady_clock::time_point* captureTime);
+
+    /**
+     * This function moves @c Header::writeStartCursor up to @c Header::writeEndCursor and notifies the @c Readers.
+     *
+     * @param captureTime The time at which the first published word was captured, or @c nullptr if it is not known.
+     */
+    void publish(const std::chrono::steady_clock::time_point* captureTime);
+
     /// The @c Policy to use for writing to the stream.
     Policy m_policy;
 
@@ -142,6 +267,9 @@ private:
      * @c Header::WriterEnabledMutex.
      */
     bool m_closed;
+
+    /// The number of words reserved by the last @c beginWrite() call which have not yet been committed.
+    size_t m_pendingWriteWords;
 };
 
 template <typename T>
@@ -151,7 +279,8 @@ template <typename T>
 SharedDataStream<T>::Writer::Writer(Policy policy, std::shared_ptr<BufferLayout> bufferLayout) :
         m_policy{policy},
         m_bufferLayout{bufferLayout},
-        m_closed{false} {
+        m_closed{false},
+        m_pendingWriteWords{0} {
     // Note - SharedDataStream::createWriter() holds writerEnableMutex while calling this function.
     auto header = m_bufferLayout->getHeader();
     header->isWriterEnabled = true;
@@ -165,6 +294,24 @@ SharedDataStream<T>::Writer::~Writer() {
 
 template <typename T>
 ssize_t SharedDataStream<T>::Writer::write(const void* buf, size_t nWords, std::chrono::milliseconds timeout) {
+    return copyIn(buf, nWords, nullptr, timeout);
+}
+
+template <typename T>
+ssize_t SharedDataStream<T>::Writer::write(
+    const void* buf,
+    size_t nWords,
+    std::chrono::steady_clock::time_point captureTime,
+    std::chrono::milliseconds timeout) {
+    return copyIn(buf, nWords, &captureTime, timeout);
+}
+
+template <typename T>
+ssize_t SharedDataStream<T>::Writer::copyIn(
+    const void* buf,
+    size_t nWords,
+    const std::chrono::steady_clock::time_point* captureTime,
+    std::chrono::milliseconds timeout) {
     if (nullptr == buf) {
         logger::acsdkError(logger::LogEntry(TAG, "writeFailed").d("reason", "nullBuffer"));
         return Error::INVALID;
@@ -174,14 +321,129 @@ ssize_t SharedDataStream<T>::Writer::write(const void* buf, size_t nWords, std::
         return Error::INVALID;
     }
 
+    auto reserved = reserve(nWords, timeout);
+    if (reserved <= 0) {
+        return reserved;
+    }
+    nWords = reserved;
+
+    auto header = m_bufferLayout->getHeader();
+    auto wordsToCopy = nWords;
+    auto buf8 = static_cast<const uint8_t*>(buf);
+
+    if (Policy::ALL_OR_NOTHING == m_policy) {
+        // If we have more data than the SDS can hold and we're not going to be overwriting oldestUnconsumedCursor, we
+        // can safely discard the initial data and just leave the trailing data in the buffer.
+        if (wordsToCopy > m_bufferLayout->getDataSize()) {
+            wordsToCopy = m_bufferLayout->getDataSize();
+            buf8 += (nWords - wordsToCopy) * getWordSize();
+        }
+    }
+
+    // Split it across the wrap.
+    size_t beforeWrap = m_bufferLayout->wordsUntilWrap(header->writeStartCursor);
+    if (beforeWrap > wordsToCopy) {
+        beforeWrap = wordsToCopy;
+    }
+    size_t afterWrap = wordsToCopy - beforeWrap;
+
+    // Copy the two segments.
+    memcpy(m_bufferLayout->getData(header->writeStartCursor), buf8, beforeWrap * getWordSize());
+    if (afterWrap > 0) {
+        memcpy(
+            m_bufferLayout->getData(header->writeStartCursor + beforeWrap),
+            buf8 + beforeWrap * getWordSize(),
+            afterWrap * getWordSize());
+    }
+
+    publish(captureTime);
+
+    return nWords;
+}
+
+template <typename T>
+ssize_t SharedDataStream<T>::Writer::beginWrite(
+    size_t nWords,
+    Span* first,
+    Span* second,
+    std::chrono::milliseconds timeout) {
+    if (nullptr == first || nullptr == second) {
+        logger::acsdkError(logger::LogEntry(TAG, "beginWriteFailed").d("reason", "nullSpan"));
+        return Error::INVALID;
+    }
+    if (0 == nWords) {
+        logger::acsdkError(logger::LogEntry(TAG, "beginWriteFailed").d("reason", "zeroNumWords"));
+        return Error::INVALID;
+    }
+
+    m_pendingWriteWords = 0;
+
+    // The reserved space must fit in the buffer, so don't let ALL_OR_NOTHING discard leading data.
+    if (nWords > m_bufferLayout->getDataSize()) {
+        nWords = m_bufferLayout->getDataSize();
+    }
+
+    auto reserved = reserve(nWords, timeout);
+    if (reserved <= 0) {
+        return reserved;
+    }
+    nWords = reserved;
+
+    // Split it across the wrap.
+    auto header = m_bufferLayout->getHeader();
+    size_t beforeWrap = m_bufferLayout->wordsUntilWrap(header->writeStartCursor);
+    if (beforeWrap > nWords) {
+        beforeWrap = nWords;
+    }
+    size_t afterWrap = nWords - beforeWrap;
+
+    first->data = m_bufferLayout->getData(header->writeStartCursor);
+    first->nWords = beforeWrap;
+    second->data = afterWrap > 0 ? m_bufferLayout->getData(header->writeStartCursor + beforeWrap) : nullptr;
+    second->nWords = afterWrap;
+
+    m_pendingWriteWords = nWords;
+    return nWords;
+}
+
+template <typename T>
+ssize_t SharedDataStream<T>::Writer::commitWrite(size_t nWords) {
+    return commit(nWords, nullptr);
+}
+
+template <typename T>
+ssize_t SharedDataStream<T>::Writer::commitWrite(size_t nWords, std::chrono::steady_clock::time_point captureTime) {
+    return commit(nWords, &captureTime);
+}
+
+template <typename T>
+ssize_t SharedDataStream<T>::Writer::commit(size_t nWords, const std::chrono::steady_clock::time_point* captureTime) {
+    if (nWords > m_pendingWriteWords) {
+        logger::acsdkError(logger::LogEntry(TAG, "commitWriteFailed")
+                               .d("reason", "invalidNumWords")
+                               .d("numWords", nWords)
+                               .d("pendingWords", m_pendingWriteWords));
+        return Error::INVALID;
+    }
+    m_pendingWriteWords = 0;
+
+    // Release any reserved space which was not used.
+    auto header = m_bufferLayout->getHeader();
+    header->writeEndCursor = header->writeStartCursor + nWords;
+
+    publish(captureTime);
+
+    return nWords;
+}
+
+template <typename T>
+ssize_t SharedDataStream<T>::Writer::reserve(size_t nWords, std::chrono::milliseconds timeout) {
     auto header = m_bufferLayout->getHeader();
     if (!header->isWriterEnabled) {
         logger::acsdkError(logger::LogEntry(TAG, "writeFailed").d("reason", "writerDisabled"));
         return Error::CLOSED;
     }
 
-    auto wordsToCopy = nWords;
-    auto buf8 = static_cast<const uint8_t*>(buf);
     std::unique_lock<Mutex> backwardSeekLock(header->backwardSeekMutex, std::defer_lock);
     Index writeEnd = header->writeStartCursor + nWords;
 
@@ -189,7 +451,7 @@ ssize_t SharedDataStream<T>::Writer::write(const void* buf, size_t nWords, std::
         case Policy::NONBLOCKABLE:
             // For NONBLOCKABLE, we can truncate the write if it won't fit in the buffer.
             if (nWords > m_bufferLayout->getDataSize()) {
-                wordsToCopy = nWords = m_bufferLayout->getDataSize();
+                nWords = m_bufferLayout->getDataSize();
                 writeEnd = header->writeStartCursor + nWords;
             }
             break;
@@ -238,7 +500,7 @@ ssize_t SharedDataStream<T>::Writer::write(const void* buf, size_t nWords, std::
 
             // For BLOCKING, we can truncate the write if it won't fit in the buffer.
             if (spaceAvailable < nWords) {
-                wordsToCopy = nWords = spaceAvailable;
+                nWords = spaceAvailable;
                 writeEnd = header->writeStartCursor + nWords;
             }
 
@@ -252,51 +514,24 @@ ssize_t SharedDataStream<T>::Writer::write(const void* buf, size_t nWords, std::
         backwardSeekLock.unlock();
     }
 
-    if (Policy::ALL_OR_NOTHING == m_policy) {
-        // If we have more data than the SDS can hold and we're not going to be overwriting oldestUnconsumedCursor, we
-        // can safely discard the initial data and just leave the trailing data in the buffer.
-        if (wordsToCopy > m_bufferLayout->getDataSize()) {
-            wordsToCopy = m_bufferLayout->getDataSize();
-            buf8 += (nWords - wordsToCopy) * getWordSize();
-        }
-    }
+    return nWords;
+}
 
-    // Split it across the wrap.
-    size_t beforeWrap = m_bufferLayout->wordsUntilWrap(header->writeStartCursor);
-    if (beforeWrap > wordsToCopy) {
-        beforeWrap = wordsToCopy;
-    }
-    size_t afterWrap = wordsToCopy - beforeWrap;
+template <typename T>
+void SharedDataStream<T>::Writer::publish(const std::chrono::steady_clock::time_point* captureTime) {
+    auto header = m_bufferLayout->getHeader();
 
-    // Copy the two segments.
-    memcpy(m_bufferLayout->getData(header->writeStartCursor), buf8, beforeWrap * getWordSize());
-    if (afterWrap > 0) {
-        memcpy(
-            m_bufferLayout->getData(header->writeStartCursor + beforeWrap),
-            buf8 + beforeWrap * getWordSize(),
-            afterWrap * getWordSize());
+    // Record the capture time before the data becomes visible to the readers.
+    if (captureTime) {
+        m_bufferLayout->recordTimestamps(header->writeStartCursor, header->writeEndCursor, *captureTime);
     }
 
     // Advance the write cursor.
-    // Note: To prevent a race condition and ensure that readers which block on dataAvailableConditionVariable don't
-    // miss a notify, we should always lock the dataAvailableConditionVariable mutex while moving writeStartCursor.  As
-    // an optimization, we skip that lock for NONBLOCKABLE writers under the assumption that they will be writing
-    // continuously, so a missed notification is not significant.
-    // Note: As a further optimization, the lock could be omitted if no blocking readers are in use (ACSDK-251).
-    std::unique_lock<Mutex> dataAvailableLock(header->dataAvailableMutex, std::defer_lock);
-    if (Policy::NONBLOCKABLE != m_policy) {
-        dataAvailableLock.lock();
-    }
     header->writeStartCursor = header->writeEndCursor.load();
-    if (Policy::NONBLOCKABLE != m_policy) {
-        dataAvailableLock.unlock();
-    }
-
-    // Notify the reader(s).
-    // Note: as an optimization, we could skip this if there are no blocking readers (ACSDK-251).
-    header->dataAvailableConditionVariable.notify_all();
 
-    return nWords;
+    // Notify the reader(s) which have enough data to wake up.  Note that this only locks dataAvailableMutex if there
+    // is a reader to wake up.
+    m_bufferLayout->notifyReaders();
 }
 
 template <typename T>
@@ -314,11 +549,9 @@ void SharedDataStream<T>::Writer::close() {
     if (header->isWriterEnabled) {
         header->isWriterEnabled = false;
 
-        std::unique_lock<Mutex> dataAvailableLock(header->dataAvailableMutex);
-
         header->hasWriterBeenClosed = true;
 
-        header->dataAvailableConditionVariable.notify_all();
+        m_bufferLayout->notifyAllReaders();
     }
     m_closed = true;
 }
@@ -26,11 +26,6 @@ enum class WriterPolicy {
     /**
      * A @c NONBLOCKABLE @c Writer will always write all the data provided without waiting for @c Readers to move
      * out of the way.
-     *
-     * @note: This policy causes the @c Writer to notify @c BLOCKING @c Readers about new data being available
-     *     without holding a mutex.  This means that a @c read() call may miss a notification and block when data
-     *     is actually available.  The assumption here is that a @c NONBLOCKABLE @c Writer will be frequently
-     *     writing data, and a subsequent @c write() will again notify the @c Reader and wake it up.
      */
     NONBLOCKABLE,
     /**
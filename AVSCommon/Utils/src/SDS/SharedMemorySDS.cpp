@@ -0,0 +1,249 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include "AVSCommon/Utils/SDS/SharedMemorySDS.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <ctime>
+
+#include "AVSCommon/Utils/Logger/Logger.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace sds {
+
+/// String to identify log entries originating from this file.
+static const std::string TAG("SharedMemorySDS");
+
+/**
+ * Create a LogEntry using this file's TAG and the specified event string.
+ *
+ * @param The event string for this @c LogEntry.
+ */
+#define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
+
+/// The permissions used when creating shared memory objects.
+static const mode_t SHARED_MEMORY_MODE = S_IRUSR | S_IWUSR;
+
+/// The number of nanoseconds in a second.
+static const long NANOSECONDS_PER_SECOND = 1000000000L;
+
+ProcessSharedMutex::ProcessSharedMutex() {
+    pthread_mutexattr_t attributes;
+    pthread_mutexattr_init(&attributes);
+    pthread_mutexattr_setpshared(&attributes, PTHREAD_PROCESS_SHARED);
+    pthread_mutexattr_setrobust(&attributes, PTHREAD_MUTEX_ROBUST);
+    int result = pthread_mutex_init(&m_mutex, &attributes);
+    if (result != 0) {
+        ACSDK_ERROR(LX("ProcessSharedMutexFailed").d("reason", "pthread_mutex_init failed").d("error", result));
+    }
+    pthread_mutexattr_destroy(&attributes);
+}
+
+ProcessSharedMutex::~ProcessSharedMutex() {
+    pthread_mutex_destroy(&m_mutex);
+}
+
+void ProcessSharedMutex::lock() {
+    int result = pthread_mutex_lock(&m_mutex);
+    if (EOWNERDEAD == result) {
+        // The previous owner died while holding the lock; take it over rather than leaving the stream wedged.
+        ACSDK_WARN(LX("lock").d("reason", "previousOwnerDied"));
+        pthread_mutex_consistent(&m_mutex);
+    } else if (result != 0) {
+        ACSDK_ERROR(LX("lockFailed").d("reason", "pthread_mutex_lock failed").d("error", result));
+    }
+}
+
+bool ProcessSharedMutex::try_lock() {
+    int result = pthread_mutex_trylock(&m_mutex);
+    if (EOWNERDEAD == result) {
+        ACSDK_WARN(LX("tryLock").d("reason", "previousOwnerDied"));
+        pthread_mutex_consistent(&m_mutex);
+        return true;
+    }
+    return 0 == result;
+}
+
+void ProcessSharedMutex::unlock() {
+    pthread_mutex_unlock(&m_mutex);
+}
+
+pthread_mutex_t* ProcessSharedMutex::native_handle() {
+    return &m_mutex;
+}
+
+ProcessSharedConditionVariable::ProcessSharedConditionVariable() {
+    pthread_condattr_t attributes;
+    pthread_condattr_init(&attributes);
+    pthread_condattr_setpshared(&attributes, PTHREAD_PROCESS_SHARED);
+    pthread_condattr_setclock(&attributes, CLOCK_MONOTONIC);
+    int result = pthread_cond_init(&m_conditionVariable, &attributes);
+    if (result != 0) {
+        ACSDK_ERROR(
+            LX("ProcessSharedConditionVariableFailed").d("reason", "pthread_cond_init failed").d("error", result));
+    }
+    pthread_condattr_destroy(&attributes);
+}
+
+ProcessSharedConditionVariable::~ProcessSharedConditionVariable() {
+    pthread_cond_destroy(&m_conditionVariable);
+}
+
+void ProcessSharedConditionVariable::notify_one() {
+    pthread_cond_signal(&m_conditionVariable);
+}
+
+void ProcessSharedConditionVariable::notify_all() {
+    pthread_cond_broadcast(&m_conditionVariable);
+}
+
+void ProcessSharedConditionVariable::wait(std::unique_lock<ProcessSharedMutex>& lock) {
+    int result = pthread_cond_wait(&m_conditionVariable, lock.mutex()->native_handle());
+    if (EOWNERDEAD == result) {
+        pthread_mutex_consistent(lock.mutex()->native_handle());
+    }
+}
+
+bool ProcessSharedConditionVariable::waitUntil(std::unique_lock<ProcessSharedMutex>& lock, const timespec& deadline) {
+    int result = pthread_cond_timedwait(&m_conditionVariable, lock.mutex()->native_handle(), &deadline);
+    if (EOWNERDEAD == result) {
+        pthread_mutex_consistent(lock.mutex()->native_handle());
+    }
+    return result != ETIMEDOUT;
+}
+
+timespec ProcessSharedConditionVariable::deadlineFromNow(std::chrono::nanoseconds timeout) {
+    timespec deadline;
+    clock_gettime(CLOCK_MONOTONIC, &deadline);
+    auto nanoseconds = deadline.tv_nsec + timeout.count() % NANOSECONDS_PER_SECOND;
+    deadline.tv_sec += timeout.count() / NANOSECONDS_PER_SECOND + nanoseconds / NANOSECONDS_PER_SECOND;
+    deadline.tv_nsec = nanoseconds % NANOSECONDS_PER_SECOND;
+    return deadline;
+}
+
+std::shared_ptr<SharedMemoryBuffer> SharedMemoryBuffer::create(const std::string& name, size_t size) {
+    if (name.empty()) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "emptyName"));
+        return nullptr;
+    }
+    if (0 == size) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "zeroSize").d("name", name));
+        return nullptr;
+    }
+
+    int fd = shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, SHARED_MEMORY_MODE);
+    if (-1 == fd) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "shm_open failed").d("name", name).d("error", strerror(errno)));
+        return nullptr;
+    }
+    if (-1 == ftruncate(fd, size)) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "ftruncate failed").d("name", name).d("error", strerror(errno)));
+        close(fd);
+        shm_unlink(name.c_str());
+        return nullptr;
+    }
+    void* data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (MAP_FAILED == data) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "mmap failed").d("name", name).d("error", strerror(errno)));
+        shm_unlink(name.c_str());
+        return nullptr;
+    }
+
+    return std::shared_ptr<SharedMemoryBuffer>(
+        new SharedMemoryBuffer(name, static_cast<uint8_t*>(data), size, true));
+}
+
+std::shared_ptr<SharedMemoryBuffer> SharedMemoryBuffer::open(const std::string& name) {
+    int fd = shm_open(name.c_str(), O_RDWR, SHARED_MEMORY_MODE);
+    if (-1 == fd) {
+        ACSDK_ERROR(LX("openFailed").d("reason", "shm_open failed").d("name", name).d("error", strerror(errno)));
+        return nullptr;
+    }
+    struct stat status;
+    if (-1 == fstat(fd, &status) || status.st_size <= 0) {
+        ACSDK_ERROR(LX("openFailed").d("reason", "invalidSize").d("name", name));
+        close(fd);
+        return nullptr;
+    }
+    size_t size = static_cast<size_t>(status.st_size);
+    void* data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (MAP_FAILED == data) {
+        ACSDK_ERROR(LX("openFailed").d("reason", "mmap failed").d("name", name).d("error", strerror(errno)));
+        return nullptr;
+    }
+
+    return std::shared_ptr<SharedMemoryBuffer>(
+        new SharedMemoryBuffer(name, static_cast<uint8_t*>(data), size, false));
+}
+
+SharedMemoryBuffer::SharedMemoryBuffer(size_t size) : m_data{nullptr}, m_size{0}, m_ownsName{false} {
+    if (0 == size) {
+        return;
+    }
+    void* data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (MAP_FAILED == data) {
+        ACSDK_ERROR(LX("SharedMemoryBufferFailed").d("reason", "mmap failed").d("error", strerror(errno)));
+        return;
+    }
+    m_data = static_cast<uint8_t*>(data);
+    m_size = size;
+}
+
+SharedMemoryBuffer::SharedMemoryBuffer(const std::string& name, uint8_t* data, size_t size, bool ownsName) :
+        m_name{name},
+        m_data{data},
+        m_size{size},
+        m_ownsName{ownsName} {
+}
+
+SharedMemoryBuffer::~SharedMemoryBuffer() {
+    if (m_data) {
+        munmap(m_data, m_size);
+    }
+    if (m_ownsName) {
+        shm_unlink(m_name.c_str());
+    }
+}
+
+uint8_t* SharedMemoryBuffer::data() {
+    return m_data;
+}
+
+const uint8_t* SharedMemoryBuffer::data() const {
+    return m_data;
+}
+
+size_t SharedMemoryBuffer::size() const {
+    return m_size;
+}
+
+std::string SharedMemoryBuffer::name() const {
+    return m_name;
+}
+
+}  // namespace sds
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
@@ -0,0 +1,134 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/// @file SharedDataStreamBenchmarkTest.cpp
+
+#include <chrono>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "AVSCommon/Utils/SDS/InProcessSDS.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace sds {
+namespace test {
+
+/// The size (in bytes) of words in the benchmarked streams (16-bit audio samples).
+static const size_t WORDSIZE = sizeof(int16_t);
+
+/// The number of words in the benchmarked streams.
+static const size_t WORDCOUNT = 16000;
+
+/// The number of words written or read per call (10 ms of 16 kHz audio).
+static const size_t FRAME_WORDS = 160;
+
+/// The number of concurrent readers (one per core on a typical 4-core device).
+static const size_t NUM_READERS = 4;
+
+/// The total number of words streamed through each benchmarked stream.
+static const size_t TOTAL_WORDS = FRAME_WORDS * 4000;
+
+/**
+ * Streams @c TOTAL_WORDS through an @c InProcessSDS with the specified @c Layout from one @c Writer to
+ * @c NUM_READERS concurrent @c Readers, each on its own thread.  The @c Writer never overruns the @c Readers, and
+ * neither side ever blocks, so the measured time is dominated by the cost of accessing the shared cursors.
+ *
+ * @param layout The @c Layout to benchmark.
+ * @return The time taken to stream the data to all of the @c Readers.
+ */
+static std::chrono::microseconds runMultiReaderBenchmark(InProcessSDS::Layout layout) {
+    size_t bufferSize = InProcessSDS::calculateBufferSize(WORDCOUNT, WORDSIZE, NUM_READERS, layout);
+    auto buffer = std::make_shared<InProcessSDS::Buffer>(bufferSize);
+    std::shared_ptr<InProcessSDS> sds = InProcessSDS::create(buffer, WORDSIZE, NUM_READERS, layout);
+    EXPECT_NE(sds, nullptr);
+    if (!sds) {
+        return std::chrono::microseconds::zero();
+    }
+    auto writer = sds->createWriter(InProcessSDS::Writer::Policy::ALL_OR_NOTHING);
+    EXPECT_NE(writer, nullptr);
+
+    std::vector<std::shared_ptr<InProcessSDS::Reader>> readers;
+    for (size_t id = 0; id < NUM_READERS; ++id) {
+        readers.push_back(sds->createReader(InProcessSDS::Reader::Policy::NONBLOCKING));
+        EXPECT_NE(readers.back(), nullptr);
+    }
+
+    auto start = std::chrono::steady_clock::now();
+
+    std::vector<std::thread> readerThreads;
+    for (auto reader : readers) {
+        readerThreads.emplace_back([reader] {
+            std::vector<int16_t> frame(FRAME_WORDS);
+            size_t wordsRead = 0;
+            while (wordsRead < TOTAL_WORDS) {
+                auto result = reader->read(frame.data(), frame.size());
+                if (result > 0) {
+                    wordsRead += result;
+                } else if (InProcessSDS::Reader::Error::WOULDBLOCK == result) {
+                    std::this_thread::yield();
+                } else {
+                    ADD_FAILURE() << "read returned " << result;
+                    return;
+                }
+            }
+        });
+    }
+
+    std::vector<int16_t> frame(FRAME_WORDS);
+    size_t wordsWritten = 0;
+    while (wordsWritten < TOTAL_WORDS) {
+        auto result = writer->write(frame.data(), frame.size());
+        if (result > 0) {
+            wordsWritten += result;
+        } else if (InProcessSDS::Writer::Error::WOULDBLOCK == result) {
+            std::this_thread::yield();
+        } else {
+            ADD_FAILURE() << "write returned " << result;
+            break;
+        }
+    }
+
+    for (auto& thread : readerThreads) {
+        thread.join();
+    }
+
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+}
+
+/**
+ * This benchmarks a single @c Writer streaming to multiple concurrent @c Readers using the packed and padded
+ * @c Layouts, to measure the cost of false sharing between the @c Readers' cursors.  The results are reported as test
+ * properties and on stdout; the test only fails if the data could not be streamed.
+ */
+TEST(SharedDataStreamBenchmarkTest, multiReaderPackedVersusPadded) {
+    auto packed = runMultiReaderBenchmark(InProcessSDS::Layout::PACKED);
+    auto padded = runMultiReaderBenchmark(InProcessSDS::Layout::PADDED);
+
+    RecordProperty("packedMicroseconds", static_cast<int>(packed.count()));
+    RecordProperty("paddedMicroseconds", static_cast<int>(padded.count()));
+    std::cout << "[ BENCHMARK] " << NUM_READERS << " readers, " << TOTAL_WORDS << " words: packed=" << packed.count()
+              << "us padded=" << padded.count() << "us" << std::endl;
+}
+
+}  // namespace test
+}  // namespace sds
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
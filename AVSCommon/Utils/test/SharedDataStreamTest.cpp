@@ -15,6 +15,7 @@
 
 /// @file SharedDataStreamTest.cpp
 
+#include <cstring>
 #include <vector>
 #include <random>
 #include <climits>
@@ -453,6 +454,58 @@ TEST_F(SharedDataStreamTest, sdsOpen) {
     ASSERT_NE(sds2, nullptr);
 }
 
+/// This tests @c SharedDataStream::create() and @c SharedDataStream::open() with @c Layout::PADDED.
+TEST_F(SharedDataStreamTest, sdsPaddedLayout) {
+    static const size_t WORDSIZE = 2;
+    static const size_t WORDCOUNT = 10;
+    static const size_t MAXREADERS = 3;
+
+    // Verify the padded layout needs more space than the packed layout.
+    size_t packedSize = Sds::calculateBufferSize(WORDCOUNT, WORDSIZE, MAXREADERS);
+    size_t paddedSize = Sds::calculateBufferSize(WORDCOUNT, WORDSIZE, MAXREADERS, Sds::Layout::PADDED);
+    ASSERT_GT(paddedSize, packedSize);
+
+    // Verify a packed-sized buffer is too small to hold a padded sds.
+    auto buffer = std::make_shared<Sds::Buffer>(packedSize);
+    ASSERT_EQ(Sds::create(buffer, WORDSIZE, MAXREADERS, Sds::Layout::PADDED), nullptr);
+
+    // Initialize a padded buffer, and verify a second sds opens it with the same parameters.
+    buffer = std::make_shared<Sds::Buffer>(paddedSize);
+    auto sds1 = Sds::create(buffer, WORDSIZE, MAXREADERS, Sds::Layout::PADDED);
+    ASSERT_NE(sds1, nullptr);
+    ASSERT_EQ(sds1->getDataSize(), WORDCOUNT);
+    auto sds2 = Sds::open(buffer);
+    ASSERT_NE(sds2, nullptr);
+    ASSERT_EQ(sds2->getDataSize(), WORDCOUNT);
+    ASSERT_EQ(sds2->getWordSize(), WORDSIZE);
+    ASSERT_EQ(sds2->getMaxReaders(), MAXREADERS);
+
+    // Verify readers created through either sds see the data written through the other.
+    auto writer = sds1->createWriter(Sds::Writer::Policy::ALL_OR_NOTHING);
+    ASSERT_NE(writer, nullptr);
+    std::vector<std::unique_ptr<Sds::Reader>> readers;
+    for (size_t id = 0; id < MAXREADERS; ++id) {
+        auto& sds = (id % 2) ? sds1 : sds2;
+        readers.push_back(sds->createReader(id, Sds::Reader::Policy::NONBLOCKING));
+        ASSERT_NE(readers.back(), nullptr);
+    }
+    ASSERT_EQ(sds2->createReader(Sds::Reader::Policy::NONBLOCKING), nullptr);
+    uint16_t writeBuf[WORDCOUNT];
+    for (size_t word = 0; word < WORDCOUNT; ++word) {
+        writeBuf[word] = word;
+    }
+    ASSERT_EQ(writer->write(writeBuf, WORDCOUNT), static_cast<ssize_t>(WORDCOUNT));
+
+    // Verify the writer is held off until every reader has consumed the data.
+    ASSERT_EQ(writer->write(writeBuf, 1), Sds::Writer::Error::WOULDBLOCK);
+    for (auto& reader : readers) {
+        uint16_t readBuf[WORDCOUNT];
+        ASSERT_EQ(reader->read(readBuf, WORDCOUNT), static_cast<ssize_t>(WORDCOUNT));
+        ASSERT_EQ(memcmp(readBuf, writeBuf, sizeof(readBuf)), 0);
+    }
+    ASSERT_EQ(writer->write(writeBuf, 1), 1);
+}
+
 /// This tests @c SharedDataStream::createWriter().
 TEST_F(SharedDataStreamTest, createWriter) {
     static const size_t WORDSIZE = 1;
@@ -646,6 +699,219 @@ TEST_F(SharedDataStreamTest, readerRead) {
     ASSERT_EQ(numRead.get(), static_cast<ssize_t>(WORDCOUNT - indexesToSkip));
 }
 
+/// This tests @c SharedDataStream::Reader::beginRead() and @c SharedDataStream::Reader::commitRead().
+TEST_F(SharedDataStreamTest, readerBeginCommitRead) {
+    static const size_t WORDSIZE = 2;
+    static const size_t WORDCOUNT = 4;
+    static const size_t MAXREADERS = 1;
+
+    // Initialize an sds.
+    size_t bufferSize = Sds::calculateBufferSize(WORDCOUNT, WORDSIZE, MAXREADERS);
+    auto buffer = std::make_shared<Sds::Buffer>(bufferSize);
+    auto sds = Sds::create(buffer, WORDSIZE, MAXREADERS);
+    ASSERT_NE(sds, nullptr);
+    auto reader = sds->createReader(Sds::Reader::Policy::NONBLOCKING);
+    ASSERT_NE(reader, nullptr);
+    auto writer = sds->createWriter(Sds::Writer::Policy::NONBLOCKABLE);
+    ASSERT_NE(writer, nullptr);
+
+    // Verify bad parameter handling.
+    Sds::Reader::Span first;
+    Sds::Reader::Span second;
+    ASSERT_EQ(reader->beginRead(WORDCOUNT, nullptr, &second), Sds::Reader::Error::INVALID);
+    ASSERT_EQ(reader->beginRead(WORDCOUNT, &first, nullptr), Sds::Reader::Error::INVALID);
+    ASSERT_EQ(reader->beginRead(0, &first, &second), Sds::Reader::Error::INVALID);
+
+    // Verify an empty stream is reported the same way read() reports it.
+    ASSERT_EQ(reader->beginRead(WORDCOUNT, &first, &second), Sds::Reader::Error::WOULDBLOCK);
+
+    // Verify data is accessible in place and is not consumed until it is committed.
+    uint16_t writeBuf[WORDCOUNT] = {1, 2, 3, 4};
+    ASSERT_EQ(writer->write(writeBuf, WORDCOUNT - 1), static_cast<ssize_t>(WORDCOUNT - 1));
+    ASSERT_EQ(reader->beginRead(WORDCOUNT, &first, &second), static_cast<ssize_t>(WORDCOUNT - 1));
+    ASSERT_EQ(first.nWords, WORDCOUNT - 1);
+    ASSERT_EQ(second.nWords, 0U);
+    ASSERT_EQ(memcmp(first.data, writeBuf, first.nWords * WORDSIZE), 0);
+    ASSERT_EQ(reader->tell(), 0U);
+
+    // Verify committing more than was returned fails, and a partial commit leaves the remainder.
+    ASSERT_EQ(reader->commitRead(WORDCOUNT), Sds::Reader::Error::INVALID);
+    ASSERT_EQ(reader->beginRead(WORDCOUNT, &first, &second), static_cast<ssize_t>(WORDCOUNT - 1));
+    ASSERT_EQ(reader->commitRead(1), 1);
+    ASSERT_EQ(reader->tell(), 1U);
+
+    // Verify data which wraps around the end of the buffer is returned as two spans.
+    ASSERT_EQ(writer->write(writeBuf + WORDCOUNT - 1, 1), 1);
+    ASSERT_EQ(writer->write(writeBuf, 1), 1);
+    ASSERT_EQ(reader->beginRead(WORDCOUNT, &first, &second), static_cast<ssize_t>(WORDCOUNT));
+    ASSERT_EQ(first.nWords, WORDCOUNT - 1);
+    ASSERT_EQ(second.nWords, 1U);
+    ASSERT_EQ(memcmp(first.data, writeBuf + 1, first.nWords * WORDSIZE), 0);
+    ASSERT_EQ(memcmp(second.data, writeBuf, second.nWords * WORDSIZE), 0);
+    ASSERT_EQ(reader->commitRead(WORDCOUNT), static_cast<ssize_t>(WORDCOUNT));
+    ASSERT_EQ(reader->tell(), static_cast<Sds::Index>(WORDCOUNT + 1));
+
+    // Verify an overwrite by a nonblockable writer while the data is borrowed is reported on commit.
+    ASSERT_EQ(writer->write(writeBuf, 1), 1);
+    ASSERT_EQ(reader->beginRead(WORDCOUNT, &first, &second), 1);
+    ASSERT_EQ(writer->write(writeBuf, WORDCOUNT), static_cast<ssize_t>(WORDCOUNT));
+    ASSERT_EQ(writer->write(writeBuf, WORDCOUNT), static_cast<ssize_t>(WORDCOUNT));
+    ASSERT_EQ(reader->commitRead(1), Sds::Reader::Error::OVERRUN);
+
+    // Verify closure is reported.
+    ASSERT_TRUE(reader->seek(0, Sds::Reader::Reference::BEFORE_WRITER));
+    reader->close();
+    ASSERT_EQ(reader->beginRead(WORDCOUNT, &first, &second), Sds::Reader::Error::CLOSED);
+}
+
+/// This tests @c SharedDataStream::Reader::setWakeupThreshold().
+TEST_F(SharedDataStreamTest, readerWakeupThreshold) {
+    static const size_t WORDSIZE = 2;
+    static const size_t WORDCOUNT = 8;
+    static const size_t MAXREADERS = 2;
+    static const size_t THRESHOLD = 4;
+    static const std::chrono::milliseconds SHORT_TIMEOUT{10};
+    static const std::chrono::milliseconds LONG_TIMEOUT{1000};
+
+    // Initialize an sds.
+    size_t bufferSize = Sds::calculateBufferSize(WORDCOUNT, WORDSIZE, MAXREADERS);
+    auto buffer = std::make_shared<Sds::Buffer>(bufferSize);
+    auto sds = Sds::create(buffer, WORDSIZE, MAXREADERS);
+    ASSERT_NE(sds, nullptr);
+
+    // Create a blocking reader with a threshold and a blocking reader without one.
+    std::shared_ptr<Sds::Reader> thresholdReader = sds->createReader(Sds::Reader::Policy::BLOCKING);
+    ASSERT_NE(thresholdReader, nullptr);
+    thresholdReader->setWakeupThreshold(THRESHOLD);
+    std::shared_ptr<Sds::Reader> defaultReader = sds->createReader(Sds::Reader::Policy::BLOCKING);
+    ASSERT_NE(defaultReader, nullptr);
+    auto writer = sds->createWriter(Sds::Writer::Policy::NONBLOCKABLE);
+    ASSERT_NE(writer, nullptr);
+
+    // Verify a timeout with partial data returns the partial data.
+    uint8_t writeBuf[WORDSIZE * WORDCOUNT] = {};
+    uint8_t thresholdReadBuf[WORDSIZE * WORDCOUNT];
+    uint8_t defaultReadBuf[WORDSIZE * WORDCOUNT];
+    ASSERT_EQ(writer->write(writeBuf, 1), 1);
+    ASSERT_EQ(thresholdReader->read(thresholdReadBuf, WORDCOUNT, SHORT_TIMEOUT), 1);
+
+    // Verify the threshold reader is not woken up until the threshold is reached, but the default reader is.
+    auto thresholdRead = std::async([thresholdReader, &thresholdReadBuf]() {
+        return thresholdReader->read(thresholdReadBuf, WORDCOUNT, LONG_TIMEOUT);
+    });
+    ASSERT_EQ(defaultReader->read(defaultReadBuf, WORDCOUNT, SHORT_TIMEOUT), 1);
+    auto defaultRead = std::async([defaultReader, &defaultReadBuf]() {
+        return defaultReader->read(defaultReadBuf, WORDCOUNT, LONG_TIMEOUT);
+    });
+    ASSERT_EQ(writer->write(writeBuf, THRESHOLD - 1), static_cast<ssize_t>(THRESHOLD - 1));
+    ASSERT_EQ(defaultRead.get(), static_cast<ssize_t>(THRESHOLD - 1));
+    ASSERT_EQ(thresholdRead.wait_for(SHORT_TIMEOUT), std::future_status::timeout);
+    ASSERT_EQ(writer->write(writeBuf, 1), 1);
+    ASSERT_EQ(thresholdRead.get(), static_cast<ssize_t>(THRESHOLD));
+
+    // Verify a blocked threshold reader still wakes up when the writer closes, and returns the remaining data.
+    thresholdRead = std::async([thresholdReader, &thresholdReadBuf]() {
+        return thresholdReader->read(thresholdReadBuf, WORDCOUNT, LONG_TIMEOUT);
+    });
+    ASSERT_EQ(writer->write(writeBuf, 1), 1);
+    ASSERT_EQ(thresholdRead.wait_for(SHORT_TIMEOUT), std::future_status::timeout);
+    writer->close();
+    ASSERT_EQ(thresholdRead.get(), 1);
+    ASSERT_EQ(thresholdReader->read(thresholdReadBuf, WORDCOUNT, LONG_TIMEOUT), Sds::Reader::Error::CLOSED);
+}
+
+/// This tests capture timestamps recorded by @c SharedDataStream::Writer and looked up by @c Reader::getTimestamp().
+TEST_F(SharedDataStreamTest, writerCaptureTimestamps) {
+    static const size_t WORDSIZE = 2;
+    static const size_t WORDCOUNT = 16;
+    static const size_t MAXREADERS = 2;
+    static const size_t BLOCKWORDS = 4;
+    static const std::chrono::steady_clock::time_point TIME0{std::chrono::milliseconds(1000)};
+    static const std::chrono::steady_clock::time_point TIME1{std::chrono::milliseconds(2000)};
+    static const std::chrono::steady_clock::time_point TIME2{std::chrono::milliseconds(3000)};
+
+    uint8_t writeBuf[WORDSIZE * WORDCOUNT] = {};
+    Sds::Timestamp timestamp;
+
+    // Verify a stream without capture timestamps never returns one.
+    size_t bufferSize = Sds::calculateBufferSize(WORDCOUNT, WORDSIZE, MAXREADERS);
+    auto buffer = std::make_shared<Sds::Buffer>(bufferSize);
+    auto sds = Sds::create(buffer, WORDSIZE, MAXREADERS);
+    ASSERT_NE(sds, nullptr);
+    ASSERT_EQ(sds->getTimestampBlockWords(), 0U);
+    auto writer = sds->createWriter(Sds::Writer::Policy::NONBLOCKABLE);
+    ASSERT_NE(writer, nullptr);
+    auto reader = sds->createReader(Sds::Reader::Policy::NONBLOCKING);
+    ASSERT_NE(reader, nullptr);
+    ASSERT_EQ(writer->write(writeBuf, BLOCKWORDS, TIME0), static_cast<ssize_t>(BLOCKWORDS));
+    ASSERT_FALSE(reader->getTimestamp(0, &timestamp));
+
+    // Initialize an sds with capture timestamps, and verify the timestamps don't reduce the data size.
+    bufferSize = Sds::calculateBufferSize(WORDCOUNT, WORDSIZE, MAXREADERS, Sds::Layout::PACKED, BLOCKWORDS);
+    ASSERT_GT(bufferSize, Sds::calculateBufferSize(WORDCOUNT, WORDSIZE, MAXREADERS));
+    buffer = std::make_shared<Sds::Buffer>(bufferSize);
+    sds = Sds::create(buffer, WORDSIZE, MAXREADERS, Sds::Layout::PACKED, BLOCKWORDS);
+    ASSERT_NE(sds, nullptr);
+    ASSERT_EQ(sds->getDataSize(), WORDCOUNT);
+    ASSERT_EQ(sds->getTimestampBlockWords(), BLOCKWORDS);
+    writer = sds->createWriter(Sds::Writer::Policy::NONBLOCKABLE);
+    ASSERT_NE(writer, nullptr);
+    reader = sds->createReader(Sds::Reader::Policy::NONBLOCKING);
+    ASSERT_NE(reader, nullptr);
+    ASSERT_FALSE(reader->getTimestamp(0, &timestamp));
+    ASSERT_FALSE(reader->getTimestamp(0, nullptr));
+
+    // Verify that every word of a timestamped block reports the write which started the block.
+    ASSERT_EQ(writer->write(writeBuf, BLOCKWORDS, TIME0), static_cast<ssize_t>(BLOCKWORDS));
+    for (Sds::Index index = 0; index < BLOCKWORDS; ++index) {
+        ASSERT_TRUE(reader->getTimestamp(index, &timestamp));
+        ASSERT_EQ(timestamp.index, 0U);
+        ASSERT_EQ(timestamp.captureTime, TIME0);
+    }
+
+    // Verify data which has not been written has no timestamp.
+    ASSERT_FALSE(reader->getTimestamp(BLOCKWORDS, &timestamp));
+
+    // Verify a batch write which spans several blocks tags each of them (words 4-9 cover the starts of blocks 4 and
+    // 8).
+    ASSERT_EQ(writer->write(writeBuf, 6, TIME1), 6);
+    ASSERT_TRUE(reader->getTimestamp(4, &timestamp));
+    ASSERT_EQ(timestamp.index, 4U);
+    ASSERT_EQ(timestamp.captureTime, TIME1);
+    ASSERT_TRUE(reader->getTimestamp(9, &timestamp));
+    ASSERT_EQ(timestamp.index, 4U);
+    ASSERT_EQ(timestamp.captureTime, TIME1);
+
+    // Verify an untimestamped write which doesn't start a block keeps the block's timestamp (words 10-11), but one
+    // which starts a block doesn't get a timestamp (words 12-15).
+    ASSERT_EQ(writer->write(writeBuf, 2), 2);
+    ASSERT_TRUE(reader->getTimestamp(11, &timestamp));
+    ASSERT_EQ(timestamp.index, 4U);
+    ASSERT_EQ(writer->write(writeBuf, BLOCKWORDS), static_cast<ssize_t>(BLOCKWORDS));
+    ASSERT_FALSE(reader->getTimestamp(12, &timestamp));
+
+    // Verify zero-copy writes can be timestamped, and that a timestamp which has been overwritten on wrap is no
+    // longer reported for the old data.
+    Sds::Writer::Span first, second;
+    ASSERT_EQ(writer->beginWrite(BLOCKWORDS, &first, &second), static_cast<ssize_t>(BLOCKWORDS));
+    ASSERT_EQ(writer->commitWrite(BLOCKWORDS, TIME2), static_cast<ssize_t>(BLOCKWORDS));
+    ASSERT_TRUE(reader->getTimestamp(WORDCOUNT, &timestamp));
+    ASSERT_EQ(timestamp.index, WORDCOUNT);
+    ASSERT_EQ(timestamp.captureTime, TIME2);
+    ASSERT_FALSE(reader->getTimestamp(0, &timestamp));
+    ASSERT_TRUE(reader->getTimestamp(5, &timestamp));
+    ASSERT_EQ(timestamp.captureTime, TIME1);
+
+    // Verify another stream opened on the same buffer sees the same timestamps.
+    auto sds2 = Sds::open(buffer);
+    ASSERT_NE(sds2, nullptr);
+    ASSERT_EQ(sds2->getTimestampBlockWords(), BLOCKWORDS);
+    auto reader2 = sds2->createReader(Sds::Reader::Policy::NONBLOCKING);
+    ASSERT_NE(reader2, nullptr);
+    ASSERT_TRUE(reader2->getTimestamp(WORDCOUNT, &timestamp));
+    ASSERT_EQ(timestamp.captureTime, TIME2);
+}
+
 /// This tests @c SharedDataStream::Reader::seek().
 TEST_F(SharedDataStreamTest, readerSeek) {
     static const size_t WORDSIZE = 2;
@@ -1013,6 +1279,66 @@ TEST_F(SharedDataStreamTest, writerWrite) {
     ASSERT_EQ(allOrNothing->write(writeBuf, writeWords), static_cast<ssize_t>(writeWords));
 }
 
+/// This tests @c SharedDataStream::Writer::beginWrite() and @c SharedDataStream::Writer::commitWrite().
+TEST_F(SharedDataStreamTest, writerBeginCommitWrite) {
+    static const size_t WORDSIZE = 2;
+    static const size_t WORDCOUNT = 4;
+    static const size_t MAXREADERS = 1;
+
+    // Initialize an sds.
+    size_t bufferSize = Sds::calculateBufferSize(WORDCOUNT, WORDSIZE, MAXREADERS);
+    auto buffer = std::make_shared<Sds::Buffer>(bufferSize);
+    auto sds = Sds::create(buffer, WORDSIZE, MAXREADERS);
+    ASSERT_NE(sds, nullptr);
+    auto writer = sds->createWriter(Sds::Writer::Policy::ALL_OR_NOTHING);
+    ASSERT_NE(writer, nullptr);
+    auto reader = sds->createReader(Sds::Reader::Policy::NONBLOCKING);
+    ASSERT_NE(reader, nullptr);
+
+    // Verify bad parameter handling.
+    Sds::Writer::Span first;
+    Sds::Writer::Span second;
+    ASSERT_EQ(writer->beginWrite(WORDCOUNT, nullptr, &second), Sds::Writer::Error::INVALID);
+    ASSERT_EQ(writer->beginWrite(WORDCOUNT, &first, nullptr), Sds::Writer::Error::INVALID);
+    ASSERT_EQ(writer->beginWrite(0, &first, &second), Sds::Writer::Error::INVALID);
+
+    // Verify reserved space is limited to the buffer size, and data is not visible until it is committed.
+    ASSERT_EQ(writer->beginWrite(WORDCOUNT * 2, &first, &second), static_cast<ssize_t>(WORDCOUNT));
+    ASSERT_EQ(first.nWords, WORDCOUNT);
+    ASSERT_EQ(second.nWords, 0U);
+    uint16_t words[WORDCOUNT] = {1, 2, 3, 4};
+    memcpy(first.data, words, 2 * WORDSIZE);
+    uint16_t readBuf[WORDCOUNT * 2];
+    ASSERT_EQ(reader->read(readBuf, WORDCOUNT), Sds::Reader::Error::WOULDBLOCK);
+
+    // Verify committing more than was reserved fails, and a partial commit publishes only what was written.
+    ASSERT_EQ(writer->commitWrite(WORDCOUNT + 1), Sds::Writer::Error::INVALID);
+    ASSERT_EQ(writer->beginWrite(WORDCOUNT, &first, &second), static_cast<ssize_t>(WORDCOUNT));
+    memcpy(first.data, words, 2 * WORDSIZE);
+    ASSERT_EQ(writer->commitWrite(2), 2);
+    ASSERT_EQ(writer->tell(), 2U);
+    ASSERT_EQ(reader->read(readBuf, WORDCOUNT), 2);
+    ASSERT_EQ(memcmp(readBuf, words, 2 * WORDSIZE), 0);
+
+    // Verify space which wraps around the end of the buffer is returned as two spans.
+    ASSERT_EQ(writer->beginWrite(WORDCOUNT, &first, &second), static_cast<ssize_t>(WORDCOUNT));
+    ASSERT_EQ(first.nWords, WORDCOUNT - 2);
+    ASSERT_EQ(second.nWords, 2U);
+    memcpy(first.data, words, first.nWords * WORDSIZE);
+    memcpy(second.data, words + first.nWords, second.nWords * WORDSIZE);
+    ASSERT_EQ(writer->commitWrite(WORDCOUNT), static_cast<ssize_t>(WORDCOUNT));
+    ASSERT_EQ(reader->read(readBuf, WORDCOUNT * 2), static_cast<ssize_t>(WORDCOUNT));
+    ASSERT_EQ(memcmp(readBuf, words, WORDCOUNT * WORDSIZE), 0);
+
+    // Verify the policy is applied: an all-or-nothing writer can't reserve space holding unconsumed data.
+    ASSERT_EQ(writer->write(words, WORDCOUNT), static_cast<ssize_t>(WORDCOUNT));
+    ASSERT_EQ(writer->beginWrite(1, &first, &second), Sds::Writer::Error::WOULDBLOCK);
+
+    // Verify closure is reported.
+    writer->close();
+    ASSERT_EQ(writer->beginWrite(1, &first, &second), Sds::Writer::Error::CLOSED);
+}
+
 /// This tests @c SharedDataStream::Writer::tell().
 TEST_F(SharedDataStreamTest, writerTell) {
     static const size_t WORDSIZE = 1;
@@ -0,0 +1,215 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/// @file SharedMemorySDSTest.cpp
+
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "AVSCommon/Utils/SDS/SharedMemorySDS.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace sds {
+namespace test {
+
+/// The size (in bytes) of words in the test streams.
+static const size_t WORDSIZE = sizeof(uint16_t);
+
+/// The number of words in the test streams.
+static const size_t WORDCOUNT = 1024;
+
+/// The maximum number of readers in the test streams.
+static const size_t MAXREADERS = 2;
+
+/// The number of words written in each chunk of test data.
+static const size_t CHUNK_WORDS = 100;
+
+/// The timeout used for blocking operations in these tests.
+static const std::chrono::seconds TIMEOUT(5);
+
+/// A short timeout used to check that waits time out.
+static const std::chrono::milliseconds SHORT_TIMEOUT(10);
+
+/**
+ * Generates a shared memory object name which is unique to this process and test.
+ *
+ * @param test A string identifying the test.
+ * @return A name suitable for @c SharedMemoryBuffer::create().
+ */
+static std::string uniqueName(const std::string& test) {
+    return "/SharedMemorySDSTest." + test + "." + std::to_string(getpid());
+}
+
+/**
+ * Generates a chunk of test data.
+ *
+ * @param chunk The chunk number, which is used to make each chunk's data distinct.
+ * @return A vector of @c CHUNK_WORDS words of test data.
+ */
+static std::vector<uint16_t> makeChunk(size_t chunk) {
+    std::vector<uint16_t> data(CHUNK_WORDS);
+    for (size_t i = 0; i < data.size(); ++i) {
+        data[i] = static_cast<uint16_t>(chunk * CHUNK_WORDS + i);
+    }
+    return data;
+}
+
+/// Checks that named buffers can be created, opened by name, and are unlinked when their creator is destroyed.
+TEST(SharedMemorySDSTest, bufferCreateAndOpen) {
+    auto name = uniqueName("bufferCreateAndOpen");
+    EXPECT_EQ(SharedMemoryBuffer::create("", 1), nullptr);
+    EXPECT_EQ(SharedMemoryBuffer::create(name, 0), nullptr);
+    EXPECT_EQ(SharedMemoryBuffer::open(name), nullptr);
+
+    auto created = SharedMemoryBuffer::create(name, WORDCOUNT);
+    ASSERT_NE(created, nullptr);
+    EXPECT_EQ(created->name(), name);
+    EXPECT_EQ(created->size(), WORDCOUNT);
+    EXPECT_EQ(SharedMemoryBuffer::create(name, WORDCOUNT), nullptr);
+
+    auto opened = SharedMemoryBuffer::open(name);
+    ASSERT_NE(opened, nullptr);
+    EXPECT_EQ(opened->size(), WORDCOUNT);
+    EXPECT_NE(opened->data(), created->data());
+    created->data()[WORDCOUNT - 1] = 0x5a;
+    EXPECT_EQ(opened->data()[WORDCOUNT - 1], 0x5a);
+
+    created.reset();
+    EXPECT_EQ(SharedMemoryBuffer::open(name), nullptr);
+    EXPECT_EQ(opened->data()[WORDCOUNT - 1], 0x5a);
+}
+
+/// Checks that an anonymous buffer can be constructed in the same way as other @c Buffer types.
+TEST(SharedMemorySDSTest, anonymousBuffer) {
+    size_t bufferSize = SharedMemorySDS::calculateBufferSize(WORDCOUNT, WORDSIZE, MAXREADERS);
+    auto buffer = std::make_shared<SharedMemorySDS::Buffer>(bufferSize);
+    EXPECT_NE(buffer->data(), nullptr);
+    EXPECT_EQ(buffer->size(), bufferSize);
+    EXPECT_TRUE(buffer->name().empty());
+    EXPECT_NE(SharedMemorySDS::create(buffer, WORDSIZE, MAXREADERS), nullptr);
+
+    SharedMemoryBuffer empty(0);
+    EXPECT_EQ(empty.data(), nullptr);
+    EXPECT_EQ(empty.size(), 0U);
+}
+
+/// Checks that a timed wait on a @c ProcessSharedConditionVariable times out, and that notification wakes it.
+TEST(SharedMemorySDSTest, conditionVariableWaitFor) {
+    ProcessSharedMutex mutex;
+    ProcessSharedConditionVariable conditionVariable;
+    bool flag = false;
+
+    std::unique_lock<ProcessSharedMutex> lock(mutex);
+    EXPECT_FALSE(conditionVariable.wait_for(lock, SHORT_TIMEOUT, [&flag] { return flag; }));
+
+    std::thread notifier([&] {
+        std::lock_guard<ProcessSharedMutex> notifierLock(mutex);
+        flag = true;
+        conditionVariable.notify_all();
+    });
+    EXPECT_TRUE(conditionVariable.wait_for(lock, TIMEOUT, [&flag] { return flag; }));
+    lock.unlock();
+    notifier.join();
+}
+
+/// Checks that a stream created on a named buffer can be opened through a second mapping of that buffer.
+TEST(SharedMemorySDSTest, openByName) {
+    auto name = uniqueName("openByName");
+    size_t bufferSize = SharedMemorySDS::calculateBufferSize(WORDCOUNT, WORDSIZE, MAXREADERS);
+    auto createdBuffer = SharedMemoryBuffer::create(name, bufferSize);
+    ASSERT_NE(createdBuffer, nullptr);
+    auto created = SharedMemorySDS::create(createdBuffer, WORDSIZE, MAXREADERS);
+    ASSERT_NE(created, nullptr);
+
+    auto openedBuffer = SharedMemoryBuffer::open(name);
+    ASSERT_NE(openedBuffer, nullptr);
+    auto opened = SharedMemorySDS::open(openedBuffer);
+    ASSERT_NE(opened, nullptr);
+    EXPECT_EQ(opened->getDataSize(), created->getDataSize());
+    EXPECT_EQ(opened->getWordSize(), created->getWordSize());
+    EXPECT_EQ(opened->getMaxReaders(), created->getMaxReaders());
+
+    auto writer = created->createWriter(SharedMemorySDS::Writer::Policy::BLOCKING);
+    ASSERT_NE(writer, nullptr);
+    auto reader = opened->createReader(SharedMemorySDS::Reader::Policy::BLOCKING);
+    ASSERT_NE(reader, nullptr);
+
+    auto chunk = makeChunk(0);
+    EXPECT_EQ(writer->write(chunk.data(), chunk.size()), static_cast<ssize_t>(chunk.size()));
+    std::vector<uint16_t> readBuffer(CHUNK_WORDS);
+    EXPECT_EQ(reader->read(readBuffer.data(), readBuffer.size(), TIMEOUT), static_cast<ssize_t>(chunk.size()));
+    EXPECT_EQ(readBuffer, chunk);
+}
+
+/**
+ * Checks that a @c Reader in a child process can open a stream by name, read data written before it attached, and
+ * be woken from a blocking read by a @c Writer in the parent process.
+ */
+TEST(SharedMemorySDSTest, crossProcessStreaming) {
+    auto name = uniqueName("crossProcessStreaming");
+    size_t bufferSize = SharedMemorySDS::calculateBufferSize(WORDCOUNT, WORDSIZE, MAXREADERS);
+    auto buffer = SharedMemoryBuffer::create(name, bufferSize);
+    ASSERT_NE(buffer, nullptr);
+    auto sds = SharedMemorySDS::create(buffer, WORDSIZE, MAXREADERS);
+    ASSERT_NE(sds, nullptr);
+    auto writer = sds->createWriter(SharedMemorySDS::Writer::Policy::BLOCKING);
+    ASSERT_NE(writer, nullptr);
+
+    auto firstChunk = makeChunk(0);
+    ASSERT_EQ(writer->write(firstChunk.data(), firstChunk.size()), static_cast<ssize_t>(firstChunk.size()));
+
+    pid_t child = fork();
+    ASSERT_NE(child, -1);
+    if (0 == child) {
+        // Only use async-signal-safe exits in the child so that it never runs the parent's gtest teardown.
+        auto childBuffer = SharedMemoryBuffer::open(name);
+        auto childSds = childBuffer ? SharedMemorySDS::open(childBuffer) : nullptr;
+        auto reader = childSds ? childSds->createReader(SharedMemorySDS::Reader::Policy::BLOCKING) : nullptr;
+        if (!reader) {
+            _exit(1);
+        }
+        std::vector<uint16_t> readBuffer(CHUNK_WORDS);
+        for (size_t chunk = 0; chunk < 2; ++chunk) {
+            if (reader->read(readBuffer.data(), readBuffer.size(), TIMEOUT) != static_cast<ssize_t>(CHUNK_WORDS) ||
+                readBuffer != makeChunk(chunk)) {
+                _exit(2 + chunk);
+            }
+        }
+        _exit(0);
+    }
+
+    // Give the child time to block waiting for the second chunk.
+    std::this_thread::sleep_for(SHORT_TIMEOUT);
+    auto secondChunk = makeChunk(1);
+    EXPECT_EQ(writer->write(secondChunk.data(), secondChunk.size()), static_cast<ssize_t>(secondChunk.size()));
+
+    int status = 0;
+    ASSERT_EQ(waitpid(child, &status, 0), child);
+    ASSERT_TRUE(WIFEXITED(status));
+    EXPECT_EQ(WEXITSTATUS(status), 0);
+}
+
+}  // namespace test
+}  // namespace sds
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
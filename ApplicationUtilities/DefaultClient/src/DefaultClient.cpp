@@ -232,7 +232,8 @@ bool DefaultClient::initialize(
      * writers to be created to handle the attachment.
      */
     auto attachmentManager = std::make_shared<avsCommon::avs::attachment::AttachmentManager>(
-        avsCommon::avs::attachment::AttachmentManager::AttachmentType::IN_PROCESS);
+        avsCommon::avs::attachment::AttachmentManager::AttachmentType::IN_PROCESS,
+        avsCommon::avs::attachment::AttachmentBufferPool::createFromConfig());
 
     /*
      * Creating the Context Manager - This component manages the context of each of the components to update to AVS.
@@ -73,6 +73,11 @@ static const std::chrono::seconds AMOUNT_OF_AUDIO_DATA_IN_BUFFER = std::chrono::
 /// The size of the ring buffer.
 static const size_t BUFFER_SIZE_IN_SAMPLES = (SAMPLE_RATE_HZ)*AMOUNT_OF_AUDIO_DATA_IN_BUFFER.count();
 
+#ifdef SHARED_MEMORY_AUDIO_INPUT_STREAM
+/// The name of the shared memory buffer which backs the @c AudioInputStream.
+static const std::string AUDIO_INPUT_STREAM_NAME("/alexaClientSDKAudioInputStream");
+#endif
+
 /// Key for the root node value containing configuration values for SampleApp.
 static const std::string SAMPLE_APP_CONFIG_KEY("sampleApp");
 
@@ -556,7 +561,16 @@ bool SampleApplication::initialize(
      */
     size_t bufferSize = alexaClientSDK::avsCommon::avs::AudioInputStream::calculateBufferSize(
         BUFFER_SIZE_IN_SAMPLES, WORD_SIZE, MAX_READERS);
+#ifdef SHARED_MEMORY_AUDIO_INPUT_STREAM
+    /*
+     * Give the buffer a name so that other processes (e.g. an external wake word engine) can open the stream with
+     * SharedMemoryBuffer::open() and AudioInputStream::open().
+     */
+    auto buffer =
+        alexaClientSDK::avsCommon::utils::sds::SharedMemoryBuffer::create(AUDIO_INPUT_STREAM_NAME, bufferSize);
+#else
     auto buffer = std::make_shared<alexaClientSDK::avsCommon::avs::AudioInputStream::Buffer>(bufferSize);
+#endif
     std::shared_ptr<alexaClientSDK::avsCommon::avs::AudioInputStream> sharedDataStream =
         alexaClientSDK::avsCommon::avs::AudioInputStream::create(buffer, WORD_SIZE, MAX_READERS);
 
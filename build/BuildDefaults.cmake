@@ -45,6 +45,9 @@ include (Comms)
 # Setup MRM variables.
 include (MRM)
 
+# Setup shared memory AudioInputStream variables.
+include (SharedMemorySDS)
+
 if (HAS_EXTERNAL_MEDIA_PLAYER_ADAPTERS)
     include (ExternalMediaPlayerAdapters)
 endif()
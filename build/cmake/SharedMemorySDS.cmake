@@ -0,0 +1,18 @@
+#
+# Setup the shared memory AudioInputStream compiler options.
+#
+# To share the AudioInputStream with other processes (for example, a separate wake word or beamforming process),
+# include the following option on the cmake command line.
+#     cmake <path-to-source>
+#       -DSHARED_MEMORY_AUDIO_INPUT_STREAM=ON
+#
+
+option(SHARED_MEMORY_AUDIO_INPUT_STREAM "Back the AudioInputStream with POSIX shared memory." OFF)
+
+if(SHARED_MEMORY_AUDIO_INPUT_STREAM)
+    if(WIN32)
+        message(FATAL_ERROR "SHARED_MEMORY_AUDIO_INPUT_STREAM requires POSIX shared memory.")
+    endif()
+    message("Creating ${PROJECT_NAME} with a shared memory AudioInputStream")
+    add_definitions(-DSHARED_MEMORY_AUDIO_INPUT_STREAM)
+endif()